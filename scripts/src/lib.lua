@@ -80,6 +80,7 @@ project "utils"
 		MAME_DIR .. "src/lib/util/pool.h",
 		MAME_DIR .. "src/lib/util/sha1.c",
 		MAME_DIR .. "src/lib/util/sha1.h",
+		MAME_DIR .. "src/lib/util/srlfile.h",
 		MAME_DIR .. "src/lib/util/tagmap.c",
 		MAME_DIR .. "src/lib/util/tagmap.h",
 		MAME_DIR .. "src/lib/util/unicode.c",
@@ -430,6 +430,66 @@ files {
 	MAME_DIR .. "src/tools/regrep.c",
 }
 
+--------------------------------------------------
+-- srldump
+--------------------------------------------------
+
+project("srldump")
+uuid ("7c2262be-632d-4ed8-8d10-dacdc3f74bd2")
+kind "ConsoleApp"	
+
+options {
+	"ForceCPP",
+}
+
+flags {
+	"Symbols", -- always include minimum symbols for executables 	
+}
+
+if _OPTIONS["SEPARATE_BIN"]~="1" then 
+	targetdir(MAME_DIR)
+end
+
+links {
+	"emu",
+	"utils",
+	"expat",
+	"7z",
+	"ocore_" .. _OPTIONS["osd"],
+}
+
+if _OPTIONS["with-bundled-zlib"] then
+	links {
+		"zlib",
+	}
+else
+	links {
+		"z",
+	}
+end
+
+if _OPTIONS["with-bundled-flac"] then
+	links {
+		"flac",
+	}
+else
+	links {
+		"FLAC",
+	}
+end
+
+includedirs {
+	MAME_DIR .. "src/osd",
+	MAME_DIR .. "src/emu",
+	MAME_DIR .. "src/lib/util",
+	MAME_DIR .. "3rdparty",
+}
+
+files {
+	MAME_DIR .. "src/tools/srldump.c",
+	MAME_DIR .. "src/emu/sound/okiadpcm.c",
+}
+
 --------------------------------------------------
 -- srcclean
 ---------------------------------------------------
@@ -9,6 +9,7 @@
 ***************************************************************************/
 
 #include "emu.h"
+#include "srlfile.h"
 
 
 
@@ -23,7 +24,13 @@
 device_sound_interface::device_sound_interface(const machine_config &mconfig, device_t &device)
 	: device_interface(device, "sound"),
 		m_outputs(0),
-		m_auto_allocated_inputs(0)
+		m_auto_allocated_inputs(0),
+		m_parallel_update(false),
+		m_reglog_enabled(false),
+		m_reglog_file(NULL),
+		m_reglog_stream(NULL),
+		m_reglog_timebase(0),
+		m_reglog_rate(0)
 {
 }
 
@@ -34,6 +41,7 @@ device_sound_interface::device_sound_interface(const machine_config &mconfig, de
 
 device_sound_interface::~device_sound_interface()
 {
+	global_free(m_reglog_file);
 }
 
 
@@ -226,6 +234,90 @@ int device_sound_interface::inputnum_from_device(device_t &source_device, int ou
 }
 
 
+//-------------------------------------------------
+//  log_register_write - append a register write
+//  to this device's log, stamped with the time
+//  its stream has been updated to; always update
+//  the stream before calling this
+//-------------------------------------------------
+
+void device_sound_interface::log_register_write(offs_t offset, UINT32 data)
+{
+	if (!m_reglog_enabled)
+		return;
+
+	// open the log on the first write, once our stream exists
+	if (m_reglog_file == NULL)
+	{
+		for (sound_stream *stream = m_device.machine().sound().first_stream(); stream != NULL && m_reglog_stream == NULL; stream = stream->next())
+			if (&stream->device() == &device())
+				m_reglog_stream = stream;
+
+		// name the file after the device tag, minus the leading colon
+		std::string name(device().tag() + 1);
+		strreplacechr(name, ':', '_');
+		name.append(".srl");
+
+		m_reglog_file = global_alloc(emu_file(m_device.machine().options().snapshot_directory(), OPEN_FLAG_WRITE | OPEN_FLAG_CREATE | OPEN_FLAG_CREATE_PATHS));
+		if (m_reglog_file->open(m_device.machine().basename(), PATH_SEPARATOR, name.c_str()) != FILERR_NONE)
+		{
+			logerror("Unable to open sound register log for '%s'\n", device().tag());
+			global_free(m_reglog_file);
+			m_reglog_file = NULL;
+			m_reglog_enabled = false;
+			return;
+		}
+
+		UINT8 header[SRL_HEADER_SIZE] = { 'S', 'R', 'L', 0 };
+		// sample numbers always count at the rate the stream had when the log
+		// was opened, so they stay continuous across later rate changes
+		UINT32 rate = (m_reglog_stream != NULL) ? m_reglog_stream->sample_rate() : 0;
+		UINT32 clock = device().clock();
+		m_reglog_timebase = m_reglog_rate = rate;
+		for (int bytenum = 0; bytenum < 4; bytenum++)
+		{
+			header[4 + bytenum] = SRL_VERSION >> (8 * bytenum);
+			header[8 + bytenum] = rate >> (8 * bytenum);
+			header[12 + bytenum] = clock >> (8 * bytenum);
+		}
+		m_reglog_file->write(header, sizeof(header));
+	}
+
+	// convert the stream's position into a sample number in the log's timebase
+	UINT64 sample = 0;
+	if (m_reglog_stream != NULL && m_reglog_timebase != 0)
+		sample = m_reglog_stream->sample_time().as_ticks(m_reglog_timebase);
+
+	// note any change in the stream's rate ahead of the write itself
+	if (m_reglog_stream != NULL && m_reglog_stream->sample_rate() != m_reglog_rate)
+	{
+		m_reglog_rate = m_reglog_stream->sample_rate();
+		write_reglog_record(sample, SRL_RATE_CHANGE, m_reglog_rate);
+	}
+
+	write_reglog_record(sample, offset, data);
+}
+
+
+//-------------------------------------------------
+//  write_reglog_record - write a single record
+//  to the register write log
+//-------------------------------------------------
+
+void device_sound_interface::write_reglog_record(UINT64 sample, UINT32 offset, UINT32 data)
+{
+	UINT8 record[SRL_RECORD_SIZE];
+	for (int bytenum = 0; bytenum < 8; bytenum++)
+		record[bytenum] = sample >> (8 * bytenum);
+	for (int bytenum = 0; bytenum < 4; bytenum++)
+	{
+		record[8 + bytenum] = offset >> (8 * bytenum);
+		record[12 + bytenum] = data >> (8 * bytenum);
+	}
+	m_reglog_file->write(record, sizeof(record));
+}
+
+
 //-------------------------------------------------
 //  interface_validity_check - validation for a
 //  device after the configuration has been
@@ -257,6 +349,9 @@ void device_sound_interface::interface_validity_check(validity_checker &valid) c
 
 void device_sound_interface::interface_pre_start()
 {
+	// note whether register writes should be logged
+	m_reglog_enabled = m_device.machine().options().sound_log();
+
 	// scan all the sound devices
 	sound_interface_iterator iter(m_device.machine().root_device());
 	for (device_sound_interface *sound = iter.first(); sound != NULL; sound = iter.next())
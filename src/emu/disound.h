@@ -109,6 +109,13 @@ public:
 	void set_output_gain(int outputnum, float gain);
 	int inputnum_from_device(device_t &device, int outputnum = 0) const;
 
+	// parallel stream updates
+	bool parallel_update() const { return m_parallel_update; }
+
+	// register write logging
+	bool logging_register_writes() const { return m_reglog_enabled; }
+	void log_register_write(offs_t offset, UINT32 data);
+
 protected:
 	// optional operation overrides
 	virtual void interface_validity_check(validity_checker &valid) const;
@@ -116,10 +123,24 @@ protected:
 	virtual void interface_post_start();
 	virtual void interface_pre_reset();
 
+	// opt in to updating this device's streams on a worker thread; only set
+	// this once sound_stream_update is known to touch no state outside the
+	// device (no machine().rand(), timers, callbacks or other devices)
+	void set_parallel_update(bool parallel) { m_parallel_update = parallel; }
+
 	// internal state
 	simple_list<sound_route> m_route_list;      // list of sound routes
 	int             m_outputs;                  // number of outputs from this instance
 	int             m_auto_allocated_inputs;    // number of auto-allocated inputs targeting us
+	bool            m_parallel_update;          // true if our streams may update on a worker thread
+	bool            m_reglog_enabled;           // true if -soundlog is enabled
+	emu_file *      m_reglog_file;              // register write log, opened on first write
+	sound_stream *  m_reglog_stream;            // stream whose sample time stamps the log
+	UINT32          m_reglog_timebase;          // rate the log's sample numbers count at
+	UINT32          m_reglog_rate;              // stream rate last recorded in the log
+
+private:
+	void write_reglog_record(UINT64 sample, UINT32 offset, UINT32 data);
 };
 
 // iterator
@@ -235,6 +235,12 @@ void gfx_element::set_layout(const gfx_layout &gl, const UINT8 *srcdata)
 		m_pen_usage.resize(m_total_elements);
 	else
 		m_pen_usage.clear();
+
+	// larger decoded layouts just track whether each element is a single pen
+	if (m_color_depth > 32 && !m_layout_is_raw)
+		m_solid_pen.resize(m_total_elements);
+	else
+		m_solid_pen.clear();
 }
 
 
@@ -285,6 +291,8 @@ void gfx_element::set_source_and_total(const UINT8 *source, UINT32 total)
 	// allocate a pen usage array for entries with 32 pens or less
 	if (m_color_depth <= 32)
 		m_pen_usage.resize(m_total_elements);
+	else if (!m_layout_is_raw)
+		m_solid_pen.resize(m_total_elements);
 
 	if (m_layout_is_raw)
 	{
@@ -369,11 +377,90 @@ void gfx_element::decode(UINT32 code)
 		m_pen_usage[code] = usage;
 	}
 
+	// (re)compute the solid pen for elements too deep for pen usage
+	else if (code < m_solid_pen.size())
+	{
+		const UINT8 *dp = m_gfxdata + code * m_char_modulo;
+		UINT16 solid = dp[0];
+		for (int y = 0; y < m_origheight && solid != GFX_PEN_MIXED; y++)
+		{
+			for (int x = 0; x < m_origwidth; x++)
+				if (dp[x] != solid)
+				{
+					solid = GFX_PEN_MIXED;
+					break;
+				}
+			dp += m_line_modulo;
+		}
+		m_solid_pen[code] = solid;
+	}
+
 	// no longer dirty
 	m_dirty[code] = 0;
 }
 
 
+//-------------------------------------------------
+//  decode_all - decode every dirty element now;
+//  large sets are split into chunks and handed
+//  to worker threads
+//-------------------------------------------------
+
+struct gfx_decode_range
+{
+	gfx_element *   gfx;                    // element being decoded
+	UINT32          start;                  // first code in the range
+	UINT32          end;                    // one past the last code in the range
+};
+
+void *gfx_element::decode_range_callback(void *param, int threadid)
+{
+	gfx_decode_range *range = reinterpret_cast<gfx_decode_range *>(param);
+	gfx_element &gfx = *range->gfx;
+
+	// each element only touches its own decoded data, dirty flag and usage entry
+	for (UINT32 code = range->start; code < range->end; code++)
+		if (gfx.m_dirty[code])
+			gfx.decode(code);
+	return NULL;
+}
+
+void gfx_element::decode_all()
+{
+	const UINT32 chunk = 256;
+
+	// small sets aren't worth the thread overhead
+	if (m_total_elements <= chunk)
+	{
+		for (UINT32 code = 0; code < m_total_elements; code++)
+			if (m_dirty[code])
+				decode(code);
+		return;
+	}
+
+	// build the list of ranges
+	std::vector<gfx_decode_range> ranges((m_total_elements + chunk - 1) / chunk);
+	for (UINT32 index = 0; index < ranges.size(); index++)
+	{
+		ranges[index].gfx = this;
+		ranges[index].start = index * chunk;
+		ranges[index].end = MIN((index + 1) * chunk, m_total_elements);
+	}
+
+	// queue them up and wait for everything to finish
+	osd_work_queue *queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	if (queue == NULL)
+	{
+		for (UINT32 index = 0; index < ranges.size(); index++)
+			decode_range_callback(&ranges[index], 0);
+		return;
+	}
+	osd_work_item_queue_multiple(queue, decode_range_callback, ranges.size(), &ranges[0], sizeof(ranges[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	osd_work_queue_wait(queue, osd_ticks_per_second() * 100);
+	osd_work_queue_free(queue);
+}
+
+
 
 /***************************************************************************
     DRAWGFX IMPLEMENTATIONS
@@ -429,6 +516,8 @@ void gfx_element::transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
@@ -457,6 +546,8 @@ void gfx_element::transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return opaque(dest, cliprect, code, color, flipx, flipy, destx, desty);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
@@ -477,7 +568,7 @@ void gfx_element::transpen_raw(bitmap_ind16 &dest, const rectangle &cliprect,
 {
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// render
@@ -491,7 +582,7 @@ void gfx_element::transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprect,
 {
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// render
@@ -614,7 +705,7 @@ void gfx_element::alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// get final code and color, and grab lookup tables
@@ -695,6 +786,8 @@ void gfx_element::zoom_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// render
 	color = colorbase() + granularity() * (color % colors());
@@ -727,6 +820,8 @@ void gfx_element::zoom_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// render
 	const pen_t *paldata = m_palette->pens() + colorbase() + granularity() * (color % colors());
@@ -751,7 +846,7 @@ void gfx_element::zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// render
@@ -769,7 +864,7 @@ void gfx_element::zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// render
@@ -912,7 +1007,7 @@ void gfx_element::zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// render
@@ -987,6 +1082,8 @@ void gfx_element::prio_transpen(bitmap_ind16 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return prio_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
@@ -1017,6 +1114,8 @@ void gfx_element::prio_transpen(bitmap_rgb32 &dest, const rectangle &cliprect,
 		if ((usage & (1 << trans_pen)) == 0)
 			return prio_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, priority, pmask);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
@@ -1039,7 +1138,7 @@ void gfx_element::prio_transpen_raw(bitmap_ind16 &dest, const rectangle &cliprec
 {
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
@@ -1055,7 +1154,7 @@ void gfx_element::prio_transpen_raw(bitmap_rgb32 &dest, const rectangle &cliprec
 {
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
@@ -1190,7 +1289,7 @@ void gfx_element::prio_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
@@ -1280,6 +1379,8 @@ void gfx_element::prio_zoom_transpen(bitmap_ind16 &dest, const rectangle &clipre
 		if ((usage & (1 << trans_pen)) == 0)
 			return prio_zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
@@ -1315,6 +1416,8 @@ void gfx_element::prio_zoom_transpen(bitmap_rgb32 &dest, const rectangle &clipre
 		if ((usage & (1 << trans_pen)) == 0)
 			return prio_zoom_opaque(dest, cliprect, code, color, flipx, flipy, destx, desty, scalex, scaley, priority, pmask);
 	}
+	else if (fully_transparent(code, trans_pen))
+		return;
 
 	// high bit of the mask is implicitly on
 	pmask |= 1 << 31;
@@ -1343,7 +1446,7 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_ind16 &dest, const rectangle &cl
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
@@ -1364,7 +1467,7 @@ void gfx_element::prio_zoom_transpen_raw(bitmap_rgb32 &dest, const rectangle &cl
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
@@ -1526,7 +1629,7 @@ void gfx_element::prio_zoom_alpha(bitmap_rgb32 &dest, const rectangle &cliprect,
 
 	// early out if completely transparent
 	code %= elements();
-	if (has_pen_usage() && (pen_usage(code) & ~(1 << trans_pen)) == 0)
+	if (fully_transparent(code, trans_pen))
 		return;
 
 	// high bit of the mask is implicitly on
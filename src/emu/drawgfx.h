@@ -131,6 +131,11 @@ enum
 	DRAWMODE_SHADOW
 };
 
+enum
+{
+	GFX_PEN_MIXED = 0xffff
+};
+
 enum
 {
 	GFX_PMASK_1  = 0xaaaa,
@@ -197,6 +202,19 @@ public:
 		return m_pen_usage[code];
 	}
 
+	bool fully_transparent(UINT32 code, UINT32 trans_pen)
+	{
+		if (has_pen_usage())
+			return (pen_usage(code) & ~(1 << trans_pen)) == 0;
+		if (code >= m_solid_pen.size() || trans_pen > 0xff)
+			return false;
+		if (m_dirty[code]) decode(code);
+		return m_solid_pen[code] == trans_pen;
+	}
+
+	// decode all dirty elements up front, spreading the work across worker threads
+	void decode_all();
+
 	// ----- core graphics drawing -----
 
 	// specific drawgfx implementations for each transparency type
@@ -265,6 +283,7 @@ public:
 private:
 	// internal helpers
 	void decode(UINT32 code);
+	static void *decode_range_callback(void *param, int threadid);
 
 	// internal state
 	palette_device  *m_palette;             // palette used for drawing
@@ -292,6 +311,7 @@ private:
 	dynamic_buffer  m_gfxdata_allocated;    // allocated decoded pixel data, 8bpp
 	dynamic_buffer  m_dirty;                // dirty array for detecting chars that need decoding
 	std::vector<UINT32>  m_pen_usage;      // bitmask of pens that are used (pens 0-31 only)
+	std::vector<UINT16>  m_solid_pen;      // pen filling the whole element, or GFX_PEN_MIXED (decoded layouts with >32 pens only)
 
 	bool            m_layout_is_raw;        // raw layout?
 	UINT8           m_layout_planes;        // bit planes in the layout
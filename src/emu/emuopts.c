@@ -159,6 +159,7 @@ const options_entry emu_options::s_option_entries[] =
 	{ OPTION_DEBUG ";d",                                 "0",         OPTION_BOOLEAN,    "enable/disable debugger" },
 	{ OPTION_UPDATEINPAUSE,                              "0",         OPTION_BOOLEAN,    "keep calling video updates while in pause" },
 	{ OPTION_DEBUGSCRIPT,                                NULL,        OPTION_STRING,     "script for debugger" },
+	{ OPTION_SOUNDLOG,                                   "0",         OPTION_BOOLEAN,    "log sound chip register writes to .srl files in the snapshot directory" },
 
 	// comm options
 	{ NULL,                                              NULL,        OPTION_HEADER,     "CORE COMM OPTIONS" },
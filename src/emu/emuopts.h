@@ -162,6 +162,7 @@ enum
 #define OPTION_OSLOG                "oslog"
 #define OPTION_UPDATEINPAUSE        "update_in_pause"
 #define OPTION_DEBUGSCRIPT          "debugscript"
+#define OPTION_SOUNDLOG             "soundlog"
 
 // core misc options
 #define OPTION_DRC                  "drc"
@@ -337,6 +338,7 @@ public:
 	bool oslog() const { return bool_value(OPTION_OSLOG); }
 	const char *debug_script() const { return value(OPTION_DEBUGSCRIPT); }
 	bool update_in_pause() const { return bool_value(OPTION_UPDATEINPAUSE); }
+	bool sound_log() const { return bool_value(OPTION_SOUNDLOG); }
 
 	// core misc options
 	bool drc() const { return bool_value(OPTION_DRC); }
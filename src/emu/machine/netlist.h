@@ -570,6 +570,7 @@ public:
 		register_param("OFFSET", m_offset, 0.0);
 		m_sample = netlist::netlist_time::from_hz(1); //sufficiently big enough
 		save(NAME(m_last_buffer));
+		save(NAME(m_next_sample));
 	}
 
 	ATTR_COLD void reset()
@@ -577,6 +578,7 @@ public:
 		m_cur = 0.0;
 		m_last_pos = 0;
 		m_last_buffer = netlist::netlist_time::zero;
+		m_next_sample = netlist::netlist_time::zero;
 	}
 
 	ATTR_HOT void sound_update(const netlist::netlist_time upto)
@@ -588,12 +590,16 @@ public:
 		{
 			m_buffer[m_last_pos++] = (stream_sample_t) m_cur;
 		}
+		m_next_sample = m_last_buffer + m_sample * (m_last_pos + 1);
 	}
 
 	ATTR_HOT void update()
 	{
 		nl_double val = INPANALOG(m_in) * m_mult.Value() + m_offset.Value();
-		sound_update(netlist().time());
+		/* the input usually changes many times per sample; only fill the
+		 * buffer once a sample boundary has been crossed */
+		if (netlist().time() >= m_next_sample)
+			sound_update(netlist().time());
 		/* ignore spikes */
 		if (std::abs(val) < 32767.0)
 			m_cur = val;
@@ -608,6 +614,7 @@ public:
 	{
 		m_last_pos = 0;
 		m_last_buffer = upto;
+		m_next_sample = upto + m_sample;
 		m_cur = 0.0;
 	}
 
@@ -622,6 +629,7 @@ private:
 	double m_cur;
 	int m_last_pos;
 	netlist::netlist_time m_last_buffer;
+	netlist::netlist_time m_next_sample;
 };
 
 // ----------------------------------------------------------------------------------------
@@ -224,6 +224,14 @@ void real_profiler_state::update_text(running_machine &machine)
 		}
 	}
 
+	// append the scaled texture cache statistics for this period
+	render_manager &render = machine.render();
+	if (render.scaled_cache_hits() != 0 || render.scaled_cache_misses() != 0)
+	{
+		strcatprintf(m_text, "Scaled textures: %u hits, %u misses, %dk cached\n", render.scaled_cache_hits(), render.scaled_cache_misses(), int(render.scaled_cache_bytes() / 1024));
+		render.reset_scaled_cache_stats();
+	}
+
 	// reset data set to 0
 	memset(m_data, 0, sizeof(m_data));
 }
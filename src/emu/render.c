@@ -335,10 +335,10 @@ render_texture::render_texture()
 		m_osddata(~0L),
 		m_scaler(NULL),
 		m_param(NULL),
-		m_curseq(0)
+		m_curseq(0),
+		m_scaled(NULL)
 {
 	m_sbounds.set(0, -1, 0, -1);
-	memset(m_scaled, 0, sizeof(m_scaled));
 }
 
 
@@ -376,17 +376,12 @@ void render_texture::reset(render_manager &manager, texture_scaler_func scaler,
 
 void render_texture::release()
 {
-	// free all scaled versions
-	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+	// free all scaled versions and invalidate references to the original bitmap
+	if (m_manager != NULL)
 	{
-		m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-		global_free(m_scaled[scalenum].bitmap);
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
+		m_manager->scaled_free_all(*this);
+		m_manager->invalidate_all(m_bitmap);
 	}
-
-	// invalidate references to the original bitmap as well
-	m_manager->invalidate_all(m_bitmap);
 	m_bitmap = NULL;
 	m_sbounds.set(0, -1, 0, -1);
 	m_format = TEXFORMAT_ARGB32;
@@ -416,16 +411,7 @@ void render_texture::set_bitmap(bitmap_t &bitmap, const rectangle &sbounds, text
 	m_format = format;
 
 	// invalidate all scaled versions
-	for (int scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-	{
-		if (m_scaled[scalenum].bitmap != NULL)
-		{
-			m_manager->invalidate_all(m_scaled[scalenum].bitmap);
-			global_free(m_scaled[scalenum].bitmap);
-		}
-		m_scaled[scalenum].bitmap = NULL;
-		m_scaled[scalenum].seqid = 0;
-	}
+	m_manager->scaled_free_all(*this);
 }
 
 
@@ -476,53 +462,24 @@ void render_texture::get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &t
 		bitmap_argb32 dummy;
 		bitmap_argb32 &srcbitmap = (m_bitmap != NULL) ? downcast<bitmap_argb32 &>(*m_bitmap) : dummy;
 
-		// is it a size we already have?
-		scaled_texture *scaled = NULL;
-		int scalenum;
-		for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
+		// is it a size we already have? if not, scale it now
+		render_scaled_texture *scaled = m_manager->scaled_find(*this, dwidth, dheight);
+		if (scaled == NULL)
 		{
-			scaled = &m_scaled[scalenum];
-
-			// we need a non-NULL bitmap with matching dest size
-			if (scaled->bitmap != NULL && dwidth == scaled->bitmap->width() && dheight == scaled->bitmap->height())
-				break;
-		}
-
-		// did we get one?
-		if (scalenum == ARRAY_LENGTH(m_scaled))
-		{
-			int lowest = -1;
-
-			// didn't find one -- take the entry with the lowest seqnum
-			for (scalenum = 0; scalenum < ARRAY_LENGTH(m_scaled); scalenum++)
-				if ((lowest == -1 || m_scaled[scalenum].seqid < m_scaled[lowest].seqid) && !primlist.has_reference(m_scaled[scalenum].bitmap))
-					lowest = scalenum;
-			assert_always(lowest != -1, "Too many live texture instances!");
-
-			// throw out any existing entries
-			scaled = &m_scaled[lowest];
-			if (scaled->bitmap != NULL)
-			{
-				m_manager->invalidate_all(scaled->bitmap);
-				global_free(scaled->bitmap);
-			}
-
-			// allocate a new bitmap
-			scaled->bitmap = global_alloc(bitmap_argb32(dwidth, dheight));
-			scaled->seqid = ++m_curseq;
+			scaled = &m_manager->scaled_alloc(*this, dwidth, dheight, ++m_curseq);
 
 			// let the scaler do the work
-			(*m_scaler)(*scaled->bitmap, srcbitmap, m_sbounds, m_param);
+			(*m_scaler)(scaled->bitmap(), srcbitmap, m_sbounds, m_param);
 		}
 
 		// finally fill out the new info
-		primlist.add_reference(scaled->bitmap);
-		texinfo.base = &scaled->bitmap->pix32(0);
-		texinfo.rowpixels = scaled->bitmap->rowpixels();
+		primlist.add_reference(&scaled->bitmap());
+		texinfo.base = &scaled->bitmap().pix32(0);
+		texinfo.rowpixels = scaled->bitmap().rowpixels();
 		texinfo.width = dwidth;
 		texinfo.height = dheight;
 		// palette will be set later
-		texinfo.seqid = scaled->seqid;
+		texinfo.seqid = scaled->seqid();
 	}
 }
 
@@ -1434,6 +1391,21 @@ void render_target::invalidate_all(void *refptr)
 }
 
 
+//-------------------------------------------------
+//  has_reference - return true if any of our
+//  primitive lists, including one the OSD may be
+//  drawing, references the given object
+//-------------------------------------------------
+
+bool render_target::has_reference(void *refptr)
+{
+	for (int listnum = 0; listnum < ARRAY_LENGTH(m_primlist); listnum++)
+		if (m_primlist[listnum].has_reference(refptr))
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  debug_alloc - allocate a container for a debug
 //  view
@@ -2378,9 +2350,16 @@ done:
 render_manager::render_manager(running_machine &machine)
 	: m_machine(machine),
 		m_ui_target(NULL),
+		m_scaled_head(NULL),
+		m_scaled_tail(NULL),
+		m_scaled_bytes(0),
+		m_scaled_hits(0),
+		m_scaled_misses(0),
 		m_live_textures(0),
 		m_ui_container(global_alloc(render_container(*this)))
 {
+	memset(m_scaled_hash, 0, sizeof(m_scaled_hash));
+
 	// register callbacks
 	config_register(machine, "video", config_saveload_delegate(FUNC(render_manager::config_load), this), config_saveload_delegate(FUNC(render_manager::config_save), this));
 
@@ -2401,6 +2380,10 @@ render_manager::~render_manager()
 	container_free(m_ui_container);
 	m_screen_container_list.reset();
 
+	// free anything left in the scaled texture cache
+	while (m_scaled_head != NULL)
+		scaled_free(*m_scaled_head);
+
 	// better not be any outstanding textures when we die
 	assert(m_live_textures == 0);
 }
@@ -2588,6 +2571,154 @@ void render_manager::invalidate_all(void *refptr)
 }
 
 
+//-------------------------------------------------
+//  scaled_hash - compute the cache bucket for a
+//  scaled variant of a texture
+//-------------------------------------------------
+
+UINT32 render_manager::scaled_hash(render_texture &owner, UINT32 width, UINT32 height)
+{
+	return (UINT32(FPTR(&owner) >> 4) ^ (width * 31) ^ (height * 131)) % SCALED_HASH_SIZE;
+}
+
+
+//-------------------------------------------------
+//  scaled_find - look up a cached scaled variant
+//  of a texture, marking it most recently used
+//-------------------------------------------------
+
+render_scaled_texture *render_manager::scaled_find(render_texture &owner, UINT32 width, UINT32 height)
+{
+	for (render_scaled_texture *scaled = m_scaled_hash[scaled_hash(owner, width, height)]; scaled != NULL; scaled = scaled->m_hashnext)
+		if (scaled->m_owner == &owner && scaled->m_bitmap.width() == width && scaled->m_bitmap.height() == height)
+		{
+			// move it to the head of the LRU list
+			if (scaled != m_scaled_head)
+			{
+				scaled->m_prev->m_next = scaled->m_next;
+				if (scaled->m_next != NULL)
+					scaled->m_next->m_prev = scaled->m_prev;
+				else
+					m_scaled_tail = scaled->m_prev;
+				scaled->m_prev = NULL;
+				scaled->m_next = m_scaled_head;
+				m_scaled_head->m_prev = scaled;
+				m_scaled_head = scaled;
+			}
+			m_scaled_hits++;
+			return scaled;
+		}
+
+	m_scaled_misses++;
+	return NULL;
+}
+
+
+//-------------------------------------------------
+//  scaled_alloc - allocate a new scaled variant
+//  of a texture, evicting the least recently
+//  used entries to stay within budget
+//-------------------------------------------------
+
+render_scaled_texture &render_manager::scaled_alloc(render_texture &owner, UINT32 width, UINT32 height, UINT32 seqid)
+{
+	// throw out old entries from the LRU end until the new one fits; anything a
+	// live primitive list references (including one the OSD may be drawing) has
+	// to stay, so we may temporarily go over budget
+	UINT64 needed = UINT64(width) * height * sizeof(UINT32);
+	render_scaled_texture *victim = m_scaled_tail;
+	while (victim != NULL && m_scaled_bytes + needed > SCALED_CACHE_BUDGET)
+	{
+		render_scaled_texture *prev = victim->m_prev;
+		if (!scaled_referenced(*victim))
+			scaled_free(*victim);
+		victim = prev;
+	}
+
+	// allocate the new entry at the head of the LRU list and in its bucket
+	render_scaled_texture &scaled = *global_alloc(render_scaled_texture(owner, width, height, seqid));
+	scaled.m_next = m_scaled_head;
+	if (m_scaled_head != NULL)
+		m_scaled_head->m_prev = &scaled;
+	else
+		m_scaled_tail = &scaled;
+	m_scaled_head = &scaled;
+
+	render_scaled_texture *&bucket = m_scaled_hash[scaled_hash(owner, width, height)];
+	scaled.m_hashnext = bucket;
+	bucket = &scaled;
+
+	scaled.m_ownernext = owner.m_scaled;
+	owner.m_scaled = &scaled;
+
+	m_scaled_bytes += scaled.bytes();
+	return scaled;
+}
+
+
+//-------------------------------------------------
+//  scaled_free_all - free all cached scaled
+//  variants of a texture
+//-------------------------------------------------
+
+void render_manager::scaled_free_all(render_texture &owner)
+{
+	while (owner.m_scaled != NULL)
+		scaled_free(*owner.m_scaled);
+}
+
+
+//-------------------------------------------------
+//  scaled_free - free a single cached scaled
+//  texture
+//-------------------------------------------------
+
+void render_manager::scaled_free(render_scaled_texture &scaled)
+{
+	invalidate_all(&scaled.m_bitmap);
+	m_scaled_bytes -= scaled.bytes();
+
+	// unlink from the LRU list
+	if (scaled.m_prev != NULL)
+		scaled.m_prev->m_next = scaled.m_next;
+	else
+		m_scaled_head = scaled.m_next;
+	if (scaled.m_next != NULL)
+		scaled.m_next->m_prev = scaled.m_prev;
+	else
+		m_scaled_tail = scaled.m_prev;
+
+	// unlink from the hash bucket
+	render_scaled_texture **link = &m_scaled_hash[scaled_hash(*scaled.m_owner, scaled.m_bitmap.width(), scaled.m_bitmap.height())];
+	while (*link != &scaled)
+		link = &(*link)->m_hashnext;
+	*link = scaled.m_hashnext;
+
+	// unlink from the owner's list
+	link = &scaled.m_owner->m_scaled;
+	while (*link != &scaled)
+		link = &(*link)->m_ownernext;
+	*link = scaled.m_ownernext;
+
+	global_free(&scaled);
+}
+
+
+//-------------------------------------------------
+//  scaled_referenced - return true if any target
+//  still holds a primitive list that references
+//  a cached scaled texture
+//-------------------------------------------------
+
+bool render_manager::scaled_referenced(render_scaled_texture &scaled)
+{
+	for (render_target *target = m_targetlist.first(); target != NULL; target = target->next())
+		if (target->has_reference(&scaled.m_bitmap))
+			return true;
+	return false;
+}
+
+
 //-------------------------------------------------
 //  container_alloc - allocate a new container
 //-------------------------------------------------
@@ -156,6 +156,7 @@ const UINT32 PRIMFLAG_TYPE_QUAD = 1 << PRIMFLAG_TYPE_SHIFT;
 class device_t;
 class screen_device;
 class render_container;
+class render_scaled_texture;
 class render_manager;
 struct xml_data_node;
 class render_font;
@@ -436,15 +437,6 @@ private:
 	void get_scaled(UINT32 dwidth, UINT32 dheight, render_texinfo &texinfo, render_primitive_list &primlist);
 	const rgb_t *get_adjusted_palette(render_container &container);
 
-	static const int MAX_TEXTURE_SCALES = 8;
-
-	// a scaled_texture contains a single scaled entry for a texture
-	struct scaled_texture
-	{
-		bitmap_argb32 *     bitmap;                 // final bitmap
-		UINT32              seqid;                  // sequence number
-	};
-
 	// internal state
 	render_manager *    m_manager;                  // reference to our manager
 	render_texture *    m_next;                     // next texture (for free list)
@@ -457,7 +449,44 @@ private:
 	texture_scaler_func m_scaler;                   // scaling callback
 	void *              m_param;                    // scaling callback parameter
 	UINT32              m_curseq;                   // current sequence number
-	scaled_texture      m_scaled[MAX_TEXTURE_SCALES];// array of scaled variants of this texture
+	render_scaled_texture * m_scaled;               // our cached scaled variants
+};
+
+
+// ======================> render_scaled_texture
+
+// a render_scaled_texture is one scaled variant of a render_texture, held in a cache shared by all targets
+class render_scaled_texture
+{
+	friend class render_manager;
+	friend class render_texture;
+
+	// construction/destruction
+	render_scaled_texture(render_texture &owner, UINT32 width, UINT32 height, UINT32 seqid)
+		: m_prev(NULL),
+			m_next(NULL),
+			m_hashnext(NULL),
+			m_ownernext(NULL),
+			m_owner(&owner),
+			m_bitmap(width, height),
+			m_seqid(seqid) { }
+
+public:
+	// getters
+	render_scaled_texture *next() const { return m_next; }
+	bitmap_argb32 &bitmap() { return m_bitmap; }
+	UINT32 seqid() const { return m_seqid; }
+	UINT32 bytes() const { return m_bitmap.rowbytes() * m_bitmap.height(); }
+
+private:
+	// internal state
+	render_scaled_texture * m_prev;                 // previous entry, in most-recently-used order
+	render_scaled_texture * m_next;                 // next entry, in most-recently-used order
+	render_scaled_texture * m_hashnext;             // next entry in the same hash bucket
+	render_scaled_texture * m_ownernext;            // next entry scaled from the same texture
+	render_texture *    m_owner;                    // texture this was scaled from
+	bitmap_argb32       m_bitmap;                   // final bitmap
+	UINT32              m_seqid;                    // sequence number
 };
 
 
@@ -655,6 +684,7 @@ public:
 
 	// reference tracking
 	void invalidate_all(void *refptr);
+	bool has_reference(void *refptr);
 
 	// debug containers
 	render_container *debug_alloc();
@@ -722,6 +752,7 @@ private:
 class render_manager
 {
 	friend class render_target;
+	friend class render_texture;
 
 public:
 	// construction/destruction
@@ -760,7 +791,21 @@ public:
 	// reference tracking
 	void invalidate_all(void *refptr);
 
+	// scaled texture cache statistics
+	UINT32 scaled_cache_hits() const { return m_scaled_hits; }
+	UINT32 scaled_cache_misses() const { return m_scaled_misses; }
+	UINT64 scaled_cache_bytes() const { return m_scaled_bytes; }
+	void reset_scaled_cache_stats() { m_scaled_hits = m_scaled_misses = 0; }
+
 private:
+	// scaled texture cache
+	render_scaled_texture *scaled_find(render_texture &owner, UINT32 width, UINT32 height);
+	render_scaled_texture &scaled_alloc(render_texture &owner, UINT32 width, UINT32 height, UINT32 seqid);
+	void scaled_free_all(render_texture &owner);
+	void scaled_free(render_scaled_texture &scaled);
+	bool scaled_referenced(render_scaled_texture &scaled);
+	static UINT32 scaled_hash(render_texture &owner, UINT32 width, UINT32 height);
+
 	// containers
 	render_container *container_alloc(screen_device *screen = NULL);
 	void container_free(render_container *container);
@@ -776,6 +821,16 @@ private:
 	simple_list<render_target>      m_targetlist;       // list of targets
 	render_target *                 m_ui_target;        // current UI target
 
+	// scaled texture cache, hashed by (owner, width, height) with a most recently used list
+	static const UINT64             SCALED_CACHE_BUDGET = 64 * 1024 * 1024;
+	static const int                SCALED_HASH_SIZE = 256;
+	render_scaled_texture *         m_scaled_hash[SCALED_HASH_SIZE]; // hash buckets of cached scaled textures
+	render_scaled_texture *         m_scaled_head;      // most recently used scaled texture
+	render_scaled_texture *         m_scaled_tail;      // least recently used scaled texture
+	UINT64                          m_scaled_bytes;     // bytes held by the cache
+	UINT32                          m_scaled_hits;      // lookups satisfied by the cache
+	UINT32                          m_scaled_misses;    // lookups that had to run a scaler
+
 	// texture lists
 	UINT32                          m_live_textures;    // number of live textures
 	fixed_allocator<render_texture> m_texture_allocator;// texture allocator
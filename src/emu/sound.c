@@ -53,6 +53,8 @@ sound_stream::sound_stream(device_t &device, int inputs, int outputs, int sample
 		m_next(NULL),
 		m_sample_rate(sample_rate),
 		m_new_sample_rate(0),
+		m_graph_level(0),
+		m_parallel(false),
 		m_attoseconds_per_sample(0),
 		m_max_samples_per_update(0),
 		m_input(inputs),
@@ -250,6 +252,9 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 	if (input.m_source != NULL)
 		input.m_source->m_dependents++;
 
+	// the graph has changed, so the update levels must be recomputed
+	m_device.machine().sound().m_update_levels_dirty = true;
+
 	// update sample rates now that we know the input
 	recompute_sample_rate_data();
 }
@@ -261,6 +266,21 @@ void sound_stream::set_input(int index, sound_stream *input_stream, int output_i
 //-------------------------------------------------
 
 void sound_stream::update()
+{
+	g_profiler.start(PROFILER_SOUND);
+	update_to_current_time();
+	g_profiler.stop();
+}
+
+
+//-------------------------------------------------
+//  update_to_current_time - generate samples up
+//  to the current emulated time; this is the
+//  body of update() without the profiler, so it
+//  may be called from a work queue thread
+//-------------------------------------------------
+
+void sound_stream::update_to_current_time()
 {
 	// determine the number of samples since the start of this second
 	attotime time = m_device.machine().time();
@@ -282,11 +302,9 @@ void sound_stream::update()
 	}
 
 	// generate samples to get us up to the appropriate time
-	g_profiler.start(PROFILER_SOUND);
 	assert(m_output_sampindex - m_output_base_sampindex >= 0);
 	assert(update_sampindex - m_output_base_sampindex <= m_output_bufalloc);
 	generate_samples(update_sampindex - m_output_sampindex);
-	g_profiler.stop();
 
 	// remember this info for next time
 	m_output_sampindex = update_sampindex;
@@ -613,7 +631,7 @@ void sound_stream::generate_samples(int samples)
 		// update the stream to the current time
 		stream_input &input = m_input[inputnum];
 		if (input.m_source != NULL)
-			input.m_source->m_stream->update();
+			input.m_source->m_stream->update_to_current_time();
 
 		// generate the resampled data
 		m_input_array[inputnum] = generate_resampled_data(input, samples);
@@ -686,8 +704,12 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 	// compute the stepping fraction
 	UINT32 step = (UINT64(input_stream.m_sample_rate) << FRAC_BITS) / m_sample_rate;
 
+	// if we have equal sample rates and unity gain, this is a straight copy
+	if (step == FRAC_ONE && gain == 0x100)
+		memcpy(dest, source, numsamples * sizeof(*dest));
+
 	// if we have equal sample rates, we just need to copy
-	if (step == FRAC_ONE)
+	else if (step == FRAC_ONE)
 	{
 		while (numsamples--)
 		{
@@ -702,11 +724,13 @@ stream_sample_t *sound_stream::generate_resampled_data(stream_input &input, UINT
 	{
 		while (numsamples != 0)
 		{
-			// fill in with point samples until we hit a boundary
+			// fill in with point samples until we hit a boundary; the scaled
+			// source sample is the same for the whole run
+			stream_sample_t point = (source[0] * gain) >> 8;
 			int nextfrac;
 			while ((nextfrac = basefrac + step) < FRAC_ONE && numsamples--)
 			{
-				*dest++ = (source[0] * gain) >> 8;
+				*dest++ = point;
 				basefrac = nextfrac;
 			}
 
@@ -818,7 +842,9 @@ sound_manager::sound_manager(running_machine &machine)
 		m_nosound_mode(machine.osd().no_sound()),
 		m_wavfile(NULL),
 		m_update_attoseconds(STREAMS_UPDATE_ATTOTIME.attoseconds),
-		m_last_update(attotime::zero)
+		m_last_update(attotime::zero),
+		m_update_queue(NULL),
+		m_update_levels_dirty(true)
 {
 	// get filename for WAV file or AVI file if specified
 	const char *wavfile = machine.options().wav_write();
@@ -866,6 +892,11 @@ sound_manager::~sound_manager()
 	if (m_wavfile != NULL)
 		wav_close(m_wavfile);
 	m_wavfile = NULL;
+
+	// free the update queue
+	if (m_update_queue != NULL)
+		osd_work_queue_free(m_update_queue);
+	m_update_queue = NULL;
 }
 
 
@@ -875,6 +906,7 @@ sound_manager::~sound_manager()
 
 sound_stream *sound_manager::stream_alloc(device_t &device, int inputs, int outputs, int sample_rate, stream_update_delegate callback)
 {
+	m_update_levels_dirty = true;
 	return &m_stream_list.append(*global_alloc(sound_stream(device, inputs, outputs, sample_rate, callback)));
 }
 
@@ -1037,6 +1069,9 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.start(PROFILER_SOUND);
 
+	// bring parallel-safe streams up to date on the work queue first
+	update_streams_by_level();
+
 	// force all the speaker streams to generate the proper number of samples
 	int samples_this_update = 0;
 	speaker_device_iterator iter(machine().root_device());
@@ -1048,25 +1083,42 @@ void sound_manager::update(void *ptr, int param)
 	UINT32 finalmix_offset = 0;
 	INT16 *finalmix = &m_finalmix[0];
 	int sample;
-	for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
+
+	// at normal speed every mixed sample is used exactly once, so clamp and
+	// interleave in a straight loop the compiler can vectorize
+	if (finalmix_step == 1000 && m_finalmix_leftover == 0)
+	{
+		const INT32 *leftmix = &m_leftmix[0];
+		const INT32 *rightmix = &m_rightmix[0];
+		for (int sampindex = 0; sampindex < samples_this_update; sampindex++)
+		{
+			finalmix[finalmix_offset++] = MAX(-32768, MIN(32767, leftmix[sampindex]));
+			finalmix[finalmix_offset++] = MAX(-32768, MIN(32767, rightmix[sampindex]));
+		}
+		sample = samples_this_update * 1000;
+	}
+	else
 	{
-		int sampindex = sample / 1000;
-
-		// clamp the left side
-		INT32 samp = m_leftmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
-
-		// clamp the right side
-		samp = m_rightmix[sampindex];
-		if (samp < -32768)
-			samp = -32768;
-		else if (samp > 32767)
-			samp = 32767;
-		finalmix[finalmix_offset++] = samp;
+		for (sample = m_finalmix_leftover; sample < samples_this_update * 1000; sample += finalmix_step)
+		{
+			int sampindex = sample / 1000;
+
+			// clamp the left side
+			INT32 samp = m_leftmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+
+			// clamp the right side
+			samp = m_rightmix[sampindex];
+			if (samp < -32768)
+				samp = -32768;
+			else if (samp > 32767)
+				samp = 32767;
+			finalmix[finalmix_offset++] = samp;
+		}
 	}
 	m_finalmix_leftover = sample - samples_this_update * 1000;
 
@@ -1102,3 +1154,168 @@ void sound_manager::update(void *ptr, int param)
 
 	g_profiler.stop();
 }
+
+
+//-------------------------------------------------
+//  compute_update_levels - sort the streams into
+//  levels such that every stream's inputs are at
+//  a lower level, then group each level's
+//  parallel-safe streams by owning device
+//-------------------------------------------------
+
+void sound_manager::compute_update_levels()
+{
+	// the graph is acyclic, so relax the levels until they settle
+	int maxlevel = 0;
+	bool changed = true;
+	for (sound_stream *stream = m_stream_list.first(); stream != NULL; stream = stream->next())
+	{
+		device_sound_interface *sound;
+		stream->m_graph_level = 0;
+		stream->m_parallel = stream->device().interface(sound) && sound->parallel_update();
+	}
+	while (changed)
+	{
+		changed = false;
+		for (sound_stream *stream = m_stream_list.first(); stream != NULL; stream = stream->next())
+			for (unsigned int inputnum = 0; inputnum < stream->m_input.size(); inputnum++)
+			{
+				sound_stream::stream_output *source = stream->m_input[inputnum].m_source;
+				if (source != NULL && source->m_stream->m_graph_level >= stream->m_graph_level)
+				{
+					stream->m_graph_level = source->m_stream->m_graph_level + 1;
+					maxlevel = MAX(maxlevel, stream->m_graph_level);
+					changed = true;
+				}
+			}
+	}
+
+	// a stream may only run on a worker if everything upstream of it may too,
+	// since updating it pulls its inputs along; a device's streams may share
+	// state, so one serial stream makes all of that device's streams serial
+	changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (sound_stream *stream = m_stream_list.first(); stream != NULL; stream = stream->next())
+		{
+			if (!stream->m_parallel)
+				continue;
+			for (unsigned int inputnum = 0; inputnum < stream->m_input.size(); inputnum++)
+			{
+				sound_stream::stream_output *source = stream->m_input[inputnum].m_source;
+				if (source != NULL && !source->m_stream->m_parallel)
+					stream->m_parallel = false;
+			}
+			for (sound_stream *other = m_stream_list.first(); other != NULL; other = other->next())
+				if (&other->device() == &stream->device() && !other->m_parallel)
+					stream->m_parallel = false;
+			if (!stream->m_parallel)
+				changed = true;
+		}
+	}
+
+	// build the update order from the parallel-safe streams only; streams of
+	// the same device stay together and in list order
+	m_update_order.clear();
+	m_update_groups.clear();
+	m_update_level_start.clear();
+	std::vector<sound_stream *> pending;
+	for (int level = 0; level <= maxlevel; level++)
+	{
+		m_update_level_start.push_back(m_update_groups.size());
+
+		pending.clear();
+		for (sound_stream *stream = m_stream_list.first(); stream != NULL; stream = stream->next())
+			if (stream->m_graph_level == level && stream->m_parallel)
+				pending.push_back(stream);
+
+		for (unsigned int index = 0; index < pending.size(); index++)
+			if (pending[index] != NULL)
+			{
+				stream_update_group group;
+				group.m_stream = NULL;
+				group.m_count = m_update_order.size();
+				device_t *device = &pending[index]->device();
+				for (unsigned int other = index; other < pending.size(); other++)
+					if (pending[other] != NULL && &pending[other]->device() == device)
+					{
+						m_update_order.push_back(pending[other]);
+						pending[other] = NULL;
+					}
+				group.m_count = m_update_order.size() - group.m_count;
+				m_update_groups.push_back(group);
+			}
+	}
+	m_update_level_start.push_back(m_update_groups.size());
+
+	// now that the order array is complete, point the groups into it
+	int first = 0;
+	for (unsigned int groupnum = 0; groupnum < m_update_groups.size(); groupnum++)
+	{
+		m_update_groups[groupnum].m_stream = &m_update_order[first];
+		first += m_update_groups[groupnum].m_count;
+	}
+
+	// only spin up worker threads once some level has independent groups to
+	// run side by side; most systems never get that far
+	if (m_update_queue == NULL)
+		for (unsigned int level = 0; level + 1 < m_update_level_start.size(); level++)
+			if (m_update_level_start[level + 1] - m_update_level_start[level] > 1)
+			{
+				m_update_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+				break;
+			}
+
+	m_update_levels_dirty = false;
+}
+
+
+//-------------------------------------------------
+//  update_streams_by_level - bring the streams of
+//  devices that opted in to parallel updates up
+//  to the current time, one level at a time;
+//  every other stream is left to be pulled
+//  serially by the speakers, in the original
+//  order, so callbacks that touch shared machine
+//  state (machine().rand() and the like) stay
+//  deterministic
+//-------------------------------------------------
+
+void sound_manager::update_streams_by_level()
+{
+	if (m_update_levels_dirty)
+		compute_update_levels();
+
+	for (unsigned int level = 0; level + 1 < m_update_level_start.size(); level++)
+	{
+		int first = m_update_level_start[level];
+		int count = m_update_level_start[level + 1] - first;
+
+		// a single group isn't worth the trip through the queue
+		if (count == 1 || (count > 1 && m_update_queue == NULL))
+		{
+			for (int groupnum = first; groupnum < first + count; groupnum++)
+				update_group_callback(&m_update_groups[groupnum], 0);
+		}
+		else if (count > 1)
+		{
+			osd_work_item_queue_multiple(m_update_queue, update_group_callback, count, &m_update_groups[first], sizeof(m_update_groups[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+			osd_work_queue_wait(m_update_queue, osd_ticks_per_second() * 10);
+		}
+	}
+}
+
+
+//-------------------------------------------------
+//  update_group_callback - update all streams in
+//  a group
+//-------------------------------------------------
+
+void *sound_manager::update_group_callback(void *param, int threadid)
+{
+	stream_update_group *group = (stream_update_group *)param;
+	for (int index = 0; index < group->m_count; index++)
+		group->m_stream[index]->update_to_current_time();
+	return NULL;
+}
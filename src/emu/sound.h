@@ -128,6 +128,7 @@ private:
 	// helpers called by our friends only
 	void update_with_accounting(bool second_tick);
 	void apply_sample_rate_changes();
+	void update_to_current_time();
 
 	// internal helpers
 	void recompute_sample_rate_data();
@@ -146,6 +147,8 @@ private:
 	UINT32              m_sample_rate;                // sample rate of this stream
 	UINT32              m_new_sample_rate;            // newly-set sample rate for the stream
 	bool                m_synchronous;                // synchronous stream that runs at the rate of its input
+	int                 m_graph_level;                // depth of this stream in the input graph
+	bool                m_parallel;                   // true if this stream may update on a worker thread
 
 	// timing information
 	attoseconds_t       m_attoseconds_per_sample;     // number of attoseconds per sample
@@ -226,6 +229,16 @@ private:
 	void config_save(int config_type, xml_data_node *parentnode);
 
 	void update(void *ptr = NULL, INT32 param = 0);
+	void compute_update_levels();
+	void update_streams_by_level();
+	static void *update_group_callback(void *param, int threadid);
+
+	// a set of streams belonging to one device at one graph level
+	struct stream_update_group
+	{
+		sound_stream **     m_stream;               // first stream in the group
+		int                 m_count;                // number of streams in the group
+	};
 
 	// internal state
 	running_machine &   m_machine;              // reference to our machine
@@ -246,6 +259,13 @@ private:
 	simple_list<sound_stream> m_stream_list;    // list of streams
 	attoseconds_t       m_update_attoseconds;   // attoseconds between global updates
 	attotime            m_last_update;          // last update time
+
+	// levelled update information
+	osd_work_queue *    m_update_queue;         // work queue for updating independent streams
+	bool                m_update_levels_dirty;  // true if the stream graph has changed
+	std::vector<sound_stream *> m_update_order;           // streams ordered by level, then device
+	std::vector<stream_update_group> m_update_groups;     // groups of streams updated together
+	std::vector<int>    m_update_level_start;   // first group of each level, plus a terminator
 };
 
 
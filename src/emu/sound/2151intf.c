@@ -28,6 +28,9 @@ ym2151_device::ym2151_device(const machine_config &mconfig, const char *tag, dev
 		m_irqhandler(*this),
 		m_portwritehandler(*this)
 {
+	// the update only touches the chip's own state (timers are handled by
+	// MAME timers), so it is safe to run on a worker thread
+	set_parallel_update(true);
 }
 
 
@@ -60,6 +63,12 @@ WRITE8_MEMBER( ym2151_device::write )
 	}
 	else
 		m_lastreg = data;
+
+	if (logging_register_writes())
+	{
+		m_stream->update();
+		log_register_write(offset & 1, data);
+	}
 }
 
 
@@ -61,6 +61,44 @@ void aica_dsp_init(AICADSP *DSP)
 	DSP->Stopped=1;
 }
 
+//decode the MPRO words into fields once, rather than on every sample
+static void DecodeMPRO(AICADSP *DSP)
+{
+	int step;
+	for(step=0;step<128;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*8;
+		AICADSP_OP *Op=DSP->DecodedMPRO+step;
+
+		Op->TRA=(IPtr[0]>>9)&0x7F;
+		Op->TWT=(IPtr[0]>>8)&0x01;
+		Op->TWA=(IPtr[0]>>1)&0x7F;
+		Op->XSEL=(IPtr[2]>>15)&0x01;
+		Op->YSEL=(IPtr[2]>>13)&0x03;
+		Op->IRA=(IPtr[2]>>7)&0x3F;
+		Op->IWT=(IPtr[2]>>6)&0x01;
+		Op->IWA=(IPtr[2]>>1)&0x1F;
+		Op->TABLE=(IPtr[4]>>15)&0x01;
+		Op->MWT=(IPtr[4]>>14)&0x01;
+		Op->MRD=(IPtr[4]>>13)&0x01;
+		Op->EWT=(IPtr[4]>>12)&0x01;
+		Op->EWA=(IPtr[4]>>8)&0x0F;
+		Op->ADRL=(IPtr[4]>>7)&0x01;
+		Op->FRCL=(IPtr[4]>>6)&0x01;
+		Op->SHIFT=(IPtr[4]>>4)&0x03;
+		Op->YRL=(IPtr[4]>>3)&0x01;
+		Op->NEGB=(IPtr[4]>>2)&0x01;
+		Op->ZERO=(IPtr[4]>>1)&0x01;
+		Op->BSEL=(IPtr[4]>>0)&0x01;
+		Op->NOFL=(IPtr[6]>>15)&1;
+		Op->COEF=step;
+		Op->MASA=(IPtr[6]>>9)&0x1f;
+		Op->ADREB=(IPtr[6]>>8)&0x1;
+		Op->NXADR=(IPtr[6]>>7)&0x1;
+	}
+	DSP->MPRODecoded=1;
+}
+
 void aica_dsp_step(AICADSP *DSP)
 {
 	INT32 ACC=0;    //26 bit
@@ -79,6 +117,9 @@ void aica_dsp_step(AICADSP *DSP)
 	if(DSP->Stopped)
 		return;
 
+	if(!DSP->MPRODecoded)
+		DecodeMPRO(DSP);
+
 	memset(DSP->EFREG,0,2*16);
 #if 0
 	int dump=0;
@@ -88,40 +129,33 @@ void aica_dsp_step(AICADSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*8;
-
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		UINT32 TRA=(IPtr[0]>>9)&0x7F;
-		UINT32 TWT=(IPtr[0]>>8)&0x01;
-		UINT32 TWA=(IPtr[0]>>1)&0x7F;
-
-		UINT32 XSEL=(IPtr[2]>>15)&0x01;
-		UINT32 YSEL=(IPtr[2]>>13)&0x03;
-		UINT32 IRA=(IPtr[2]>>7)&0x3F;
-		UINT32 IWT=(IPtr[2]>>6)&0x01;
-		UINT32 IWA=(IPtr[2]>>1)&0x1F;
-
-		UINT32 TABLE=(IPtr[4]>>15)&0x01;
-		UINT32 MWT=(IPtr[4]>>14)&0x01;
-		UINT32 MRD=(IPtr[4]>>13)&0x01;
-		UINT32 EWT=(IPtr[4]>>12)&0x01;
-		UINT32 EWA=(IPtr[4]>>8)&0x0F;
-		UINT32 ADRL=(IPtr[4]>>7)&0x01;
-		UINT32 FRCL=(IPtr[4]>>6)&0x01;
-		UINT32 SHIFT=(IPtr[4]>>4)&0x03;
-		UINT32 YRL=(IPtr[4]>>3)&0x01;
-		UINT32 NEGB=(IPtr[4]>>2)&0x01;
-		UINT32 ZERO=(IPtr[4]>>1)&0x01;
-		UINT32 BSEL=(IPtr[4]>>0)&0x01;
-
-		UINT32 NOFL=(IPtr[6]>>15)&1;        //????
-		UINT32 COEF=step;
-
-		UINT32 MASA=(IPtr[6]>>9)&0x1f;  //???
-		UINT32 ADREB=(IPtr[6]>>8)&0x1;
-		UINT32 NXADR=(IPtr[6]>>7)&0x1;
+		const AICADSP_OP *Op=DSP->DecodedMPRO+step;
+
+		UINT32 TRA=Op->TRA;
+		UINT32 TWT=Op->TWT;
+		UINT32 TWA=Op->TWA;
+		UINT32 XSEL=Op->XSEL;
+		UINT32 YSEL=Op->YSEL;
+		UINT32 IRA=Op->IRA;
+		UINT32 IWT=Op->IWT;
+		UINT32 IWA=Op->IWA;
+		UINT32 TABLE=Op->TABLE;
+		UINT32 MWT=Op->MWT;
+		UINT32 MRD=Op->MRD;
+		UINT32 EWT=Op->EWT;
+		UINT32 EWA=Op->EWA;
+		UINT32 ADRL=Op->ADRL;
+		UINT32 FRCL=Op->FRCL;
+		UINT32 SHIFT=Op->SHIFT;
+		UINT32 YRL=Op->YRL;
+		UINT32 NEGB=Op->NEGB;
+		UINT32 ZERO=Op->ZERO;
+		UINT32 BSEL=Op->BSEL;
+		UINT32 NOFL=Op->NOFL;
+		UINT32 COEF=Op->COEF;
+		UINT32 MASA=Op->MASA;
+		UINT32 ADREB=Op->ADREB;
+		UINT32 NXADR=Op->NXADR;
 
 		INT64 v;
 
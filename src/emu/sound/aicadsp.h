@@ -5,6 +5,36 @@
 #ifndef __AICADSP_H__
 #define __AICADSP_H__
 
+//one MPRO step, decoded into its fields
+struct AICADSP_OP
+{
+	UINT8 TRA;
+	UINT8 TWT;
+	UINT8 TWA;
+	UINT8 XSEL;
+	UINT8 YSEL;
+	UINT8 IRA;
+	UINT8 IWT;
+	UINT8 IWA;
+	UINT8 TABLE;
+	UINT8 MWT;
+	UINT8 MRD;
+	UINT8 EWT;
+	UINT8 EWA;
+	UINT8 ADRL;
+	UINT8 FRCL;
+	UINT8 SHIFT;
+	UINT8 YRL;
+	UINT8 NEGB;
+	UINT8 ZERO;
+	UINT8 BSEL;
+	UINT8 NOFL;
+	UINT8 COEF;
+	UINT8 MASA;
+	UINT8 ADREB;
+	UINT8 NXADR;
+};
+
 //the DSP Context
 struct AICADSP
 {
@@ -32,6 +62,9 @@ struct AICADSP
 
 	int Stopped;
 	int LastStep;
+
+	AICADSP_OP DecodedMPRO[128];
+	int MPRODecoded;   //cleared whenever MPRO is written
 };
 
 void aica_dsp_init(AICADSP *DSP);
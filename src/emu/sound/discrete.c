@@ -1045,12 +1045,21 @@ void discrete_device::process(int samples)
 		(*task)->prepare_for_queue(samples);
 	}
 
-	for_each(discrete_task **, task, &task_list)
+	/* A single task has no dependencies to wait on, so the round trip
+	 * through the work queue buys nothing. This is the case for every
+	 * netlist without DISCRETE_TASK_START markers.
+	 */
+	if (task_list.count() == 1)
+		discrete_task::task_callback((void *) &task_list, 0);
+	else
 	{
-		/* Fire a work item for each task */
-		osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		for_each(discrete_task **, task, &task_list)
+		{
+			/* Fire a work item for each task */
+			osd_work_item_queue(m_queue, discrete_task::task_callback, (void *) &task_list, WORK_ITEM_FLAG_AUTO_RELEASE);
+		}
+		osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 	}
-	osd_work_queue_wait(m_queue, osd_ticks_per_second()*10);
 
 	if (m_profiling)
 	{
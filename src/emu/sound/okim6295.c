@@ -39,6 +39,7 @@
 
 #include "emu.h"
 #include "okim6295.h"
+#include "srlfile.h"
 
 
 //**************************************************************************
@@ -48,6 +49,10 @@
 // device type definition
 const device_type OKIM6295 = &device_creator<okim6295_device>;
 
+// pseudo-offsets for the state changes recorded in the register write log
+const offs_t OKIM6295_REGLOG_BANK = SRL_PSEUDO_OFFSET + 0;   // data = new bank base
+const offs_t OKIM6295_REGLOG_PIN7 = SRL_PSEUDO_OFFSET + 1;   // data = new pin 7 state
+
 // volume lookup table. The manual lists only 9 steps, ~3dB per step. Given the dB values,
 // that seems to map to a 5-bit volume control. Any volume parameter beyond the 9th index
 // results in silent playback.
@@ -98,6 +103,9 @@ okim6295_device::okim6295_device(const machine_config &mconfig, const char *tag,
 		m_pin7_state(0),
 		m_direct(NULL)
 {
+	// the update only reads sample ROM through our own address space and
+	// touches the voices' own state, so it is safe to run on a worker thread
+	set_parallel_update(true);
 }
 
 
@@ -216,6 +224,7 @@ void okim6295_device::set_bank_base(offs_t base, bool bDontUpdateStream)
 	if (!bDontUpdateStream)
 	{
 		m_stream->update();
+		log_register_write(OKIM6295_REGLOG_BANK, base);
 	}
 
 	// if we are setting a non-zero base, and we have no bank, allocate one
@@ -242,8 +251,13 @@ void okim6295_device::set_bank_base(offs_t base, bool bDontUpdateStream)
 
 void okim6295_device::set_pin7(int pin7)
 {
+	// flush at the old rate, then log after the change so the new rate is
+	// recorded at the same sample
+	if (logging_register_writes())
+		m_stream->update();
 	m_pin7_state = pin7;
 	device_clock_changed();
+	log_register_write(OKIM6295_REGLOG_PIN7, pin7);
 }
 
 
@@ -367,6 +381,11 @@ void okim6295_device::write_command(UINT8 command)
 
 WRITE8_MEMBER( okim6295_device::write )
 {
+	if (logging_register_writes())
+	{
+		m_stream->update();
+		log_register_write(0, data);
+	}
 	write_command(data);
 }
 
@@ -61,6 +61,44 @@ void SCSPDSP_Init(SCSPDSP *DSP)
 	DSP->Stopped=1;
 }
 
+//decode the MPRO words into fields once, rather than on every sample
+static void DecodeMPRO(SCSPDSP *DSP)
+{
+	int step;
+	for(step=0;step<128;++step)
+	{
+		UINT16 *IPtr=DSP->MPRO+step*4;
+		SCSPDSP_OP *Op=DSP->DecodedMPRO+step;
+
+		Op->TRA=(IPtr[0]>>8)&0x7F;
+		Op->TWT=(IPtr[0]>>7)&0x01;
+		Op->TWA=(IPtr[0]>>0)&0x7F;
+		Op->XSEL=(IPtr[1]>>15)&0x01;
+		Op->YSEL=(IPtr[1]>>13)&0x03;
+		Op->IRA=(IPtr[1]>>6)&0x3F;
+		Op->IWT=(IPtr[1]>>5)&0x01;
+		Op->IWA=(IPtr[1]>>0)&0x1F;
+		Op->TABLE=(IPtr[2]>>15)&0x01;
+		Op->MWT=(IPtr[2]>>14)&0x01;
+		Op->MRD=(IPtr[2]>>13)&0x01;
+		Op->EWT=(IPtr[2]>>12)&0x01;
+		Op->EWA=(IPtr[2]>>8)&0x0F;
+		Op->ADRL=(IPtr[2]>>7)&0x01;
+		Op->FRCL=(IPtr[2]>>6)&0x01;
+		Op->SHIFT=(IPtr[2]>>4)&0x03;
+		Op->YRL=(IPtr[2]>>3)&0x01;
+		Op->NEGB=(IPtr[2]>>2)&0x01;
+		Op->ZERO=(IPtr[2]>>1)&0x01;
+		Op->BSEL=(IPtr[2]>>0)&0x01;
+		Op->NOFL=(IPtr[3]>>15)&1;
+		Op->COEF=(IPtr[3]>>9)&0x3f;
+		Op->MASA=(IPtr[3]>>2)&0x1f;
+		Op->ADREB=(IPtr[3]>>1)&0x1;
+		Op->NXADR=(IPtr[3]>>0)&0x1;
+	}
+	DSP->MPRODecoded=1;
+}
+
 void SCSPDSP_Step(SCSPDSP *DSP)
 {
 	INT32 ACC=0;    //26 bit
@@ -79,6 +117,9 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 	if(DSP->Stopped)
 		return;
 
+	if(!DSP->MPRODecoded)
+		DecodeMPRO(DSP);
+
 	memset(DSP->EFREG,0,2*16);
 #if 0
 	int dump=0;
@@ -88,40 +129,33 @@ void SCSPDSP_Step(SCSPDSP *DSP)
 #endif
 	for(step=0;step</*128*/DSP->LastStep;++step)
 	{
-		UINT16 *IPtr=DSP->MPRO+step*4;
-
-//      if(IPtr[0]==0 && IPtr[1]==0 && IPtr[2]==0 && IPtr[3]==0)
-//          break;
-
-		UINT32 TRA=(IPtr[0]>>8)&0x7F;
-		UINT32 TWT=(IPtr[0]>>7)&0x01;
-		UINT32 TWA=(IPtr[0]>>0)&0x7F;
-
-		UINT32 XSEL=(IPtr[1]>>15)&0x01;
-		UINT32 YSEL=(IPtr[1]>>13)&0x03;
-		UINT32 IRA=(IPtr[1]>>6)&0x3F;
-		UINT32 IWT=(IPtr[1]>>5)&0x01;
-		UINT32 IWA=(IPtr[1]>>0)&0x1F;
-
-		UINT32 TABLE=(IPtr[2]>>15)&0x01;
-		UINT32 MWT=(IPtr[2]>>14)&0x01;
-		UINT32 MRD=(IPtr[2]>>13)&0x01;
-		UINT32 EWT=(IPtr[2]>>12)&0x01;
-		UINT32 EWA=(IPtr[2]>>8)&0x0F;
-		UINT32 ADRL=(IPtr[2]>>7)&0x01;
-		UINT32 FRCL=(IPtr[2]>>6)&0x01;
-		UINT32 SHIFT=(IPtr[2]>>4)&0x03;
-		UINT32 YRL=(IPtr[2]>>3)&0x01;
-		UINT32 NEGB=(IPtr[2]>>2)&0x01;
-		UINT32 ZERO=(IPtr[2]>>1)&0x01;
-		UINT32 BSEL=(IPtr[2]>>0)&0x01;
-
-		UINT32 NOFL=(IPtr[3]>>15)&1;        //????
-		UINT32 COEF=(IPtr[3]>>9)&0x3f;
-
-		UINT32 MASA=(IPtr[3]>>2)&0x1f;  //???
-		UINT32 ADREB=(IPtr[3]>>1)&0x1;
-		UINT32 NXADR=(IPtr[3]>>0)&0x1;
+		const SCSPDSP_OP *Op=DSP->DecodedMPRO+step;
+
+		UINT32 TRA=Op->TRA;
+		UINT32 TWT=Op->TWT;
+		UINT32 TWA=Op->TWA;
+		UINT32 XSEL=Op->XSEL;
+		UINT32 YSEL=Op->YSEL;
+		UINT32 IRA=Op->IRA;
+		UINT32 IWT=Op->IWT;
+		UINT32 IWA=Op->IWA;
+		UINT32 TABLE=Op->TABLE;
+		UINT32 MWT=Op->MWT;
+		UINT32 MRD=Op->MRD;
+		UINT32 EWT=Op->EWT;
+		UINT32 EWA=Op->EWA;
+		UINT32 ADRL=Op->ADRL;
+		UINT32 FRCL=Op->FRCL;
+		UINT32 SHIFT=Op->SHIFT;
+		UINT32 YRL=Op->YRL;
+		UINT32 NEGB=Op->NEGB;
+		UINT32 ZERO=Op->ZERO;
+		UINT32 BSEL=Op->BSEL;
+		UINT32 NOFL=Op->NOFL;
+		UINT32 COEF=Op->COEF;
+		UINT32 MASA=Op->MASA;
+		UINT32 ADREB=Op->ADREB;
+		UINT32 NXADR=Op->NXADR;
 
 		INT64 v;
 
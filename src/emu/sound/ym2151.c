@@ -2368,6 +2368,18 @@ INLINE signed int acc_calc(signed int value)
 #endif
 
 
+/* A channel whose four operators are all at maximum attenuation, with no
+   feedback or delayed (MEM) sample still in flight, produces nothing and
+   changes no state in chan_calc()/chan7_calc(), so it can be skipped.
+   MAX_ATT_INDEX is above ENV_QUIET, which also silences the noise
+   generator on channel 7. */
+INLINE int chan_silent(const YM2151Operator *op)
+{
+	return (op[0].volume & op[1].volume & op[2].volume & op[3].volume) == MAX_ATT_INDEX &&
+			(op[0].fb_out_prev | op[0].fb_out_curr | op[0].mem_value) == 0;
+}
+
+
 /*  Generate samples for one of the YM2151's
 *
 *   'num' is the number of virtual YM2151
@@ -2417,21 +2429,29 @@ void ym2151_update_one(void *chip, SAMP **buffers, int length)
 		chanout[6] = 0;
 		chanout[7] = 0;
 
-		chan_calc(PSG, 0);
+		if (!chan_silent(&PSG->oper[0*4]))
+			chan_calc(PSG, 0);
 		SAVE_SINGLE_CHANNEL(0)
-		chan_calc(PSG, 1);
+		if (!chan_silent(&PSG->oper[1*4]))
+			chan_calc(PSG, 1);
 		SAVE_SINGLE_CHANNEL(1)
-		chan_calc(PSG, 2);
+		if (!chan_silent(&PSG->oper[2*4]))
+			chan_calc(PSG, 2);
 		SAVE_SINGLE_CHANNEL(2)
-		chan_calc(PSG, 3);
+		if (!chan_silent(&PSG->oper[3*4]))
+			chan_calc(PSG, 3);
 		SAVE_SINGLE_CHANNEL(3)
-		chan_calc(PSG, 4);
+		if (!chan_silent(&PSG->oper[4*4]))
+			chan_calc(PSG, 4);
 		SAVE_SINGLE_CHANNEL(4)
-		chan_calc(PSG, 5);
+		if (!chan_silent(&PSG->oper[5*4]))
+			chan_calc(PSG, 5);
 		SAVE_SINGLE_CHANNEL(5)
-		chan_calc(PSG, 6);
+		if (!chan_silent(&PSG->oper[6*4]))
+			chan_calc(PSG, 6);
 		SAVE_SINGLE_CHANNEL(6)
-		chan7_calc(PSG);
+		if (!chan_silent(&PSG->oper[7*4]))
+			chan7_calc(PSG);
 		SAVE_SINGLE_CHANNEL(7)
 
 		outl = chanout[0] & PSG->pan[0];
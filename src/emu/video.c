@@ -100,6 +100,7 @@ video_manager::video_manager(running_machine &machine)
 		m_snap_native(true),
 		m_snap_width(0),
 		m_snap_height(0),
+		m_snap_queue(NULL),
 		m_mng_frame_period(attotime::zero),
 		m_mng_next_frame_time(attotime::zero),
 		m_mng_frame(0),
@@ -107,6 +108,9 @@ video_manager::video_manager(running_machine &machine)
 		m_avi_frame_period(attotime::zero),
 		m_avi_next_frame_time(attotime::zero),
 		m_avi_frame(0),
+		m_avi_queue(NULL),
+		m_avi_packet_index(0),
+		m_avi_error(false),
 		m_dummy_recording(false)
 {
 	// request a callback upon exiting
@@ -116,6 +120,19 @@ video_manager::video_manager(running_machine &machine)
 	// extract initial execution state from global configuration settings
 	update_refresh_speed();
 
+	// snapshots and movie frames are rendered in bands across worker threads
+	m_snap_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+
+	// AVI data is written in order by a single I/O thread
+	m_avi_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_IO);
+	for (int packetnum = 0; packetnum < AVI_PACKETS; packetnum++)
+	{
+		m_avi_packet[packetnum].m_manager = this;
+		m_avi_packet[packetnum].m_item = NULL;
+		m_avi_packet[packetnum].m_frames = 0;
+		m_avi_packet[packetnum].m_samples = 0;
+	}
+
 	// create a render target for snapshots
 	const char *viewname = machine.options().snap_view();
 	m_snap_native = (machine.first_screen() != NULL && (viewname[0] == 0 || strcmp(viewname, "native") == 0));
@@ -478,11 +495,14 @@ void video_manager::end_recording(movie_format format)
 		// close the file if it exists
 		if (m_avi_file != NULL)
 		{
+			// let the writer finish with it first
+			avi_flush();
 			avi_close(m_avi_file);
 			m_avi_file = NULL;
 
 			// reset the state
 			m_avi_frame = 0;
+			m_avi_error = false;
 		}
 	}
 	else if (format == MF_MNG)
@@ -512,18 +532,120 @@ void video_manager::add_sound_to_recording(const INT16 *sound, int numsamples)
 	{
 		g_profiler.start(PROFILER_MOVIE_REC);
 
-		// write the next frame
-		avi_error avierr = avi_append_sound_samples(m_avi_file, 0, sound + 0, numsamples, 1);
-		if (avierr == AVIERR_NONE)
-			avierr = avi_append_sound_samples(m_avi_file, 1, sound + 1, numsamples, 1);
-		if (avierr != AVIERR_NONE)
+		// stop if the writer hit an error
+		if (m_avi_error)
 			end_recording(MF_AVI);
 
+		// hand a copy of the samples to the writer
+		else
+		{
+			avi_packet &packet = avi_next_packet();
+			packet.m_frames = 0;
+			packet.m_samples = numsamples;
+			packet.m_sound.assign(sound, sound + 2 * numsamples);
+			avi_submit_packet(packet);
+		}
+
 		g_profiler.stop();
 	}
 }
 
 
+//-------------------------------------------------
+//  avi_next_packet - return the next packet in
+//  the ring, waiting for the writer to finish
+//  with it if needed
+//-------------------------------------------------
+
+video_manager::avi_packet &video_manager::avi_next_packet()
+{
+	avi_packet &packet = m_avi_packet[m_avi_packet_index];
+	m_avi_packet_index = (m_avi_packet_index + 1) % AVI_PACKETS;
+
+	// if the writer has fallen this far behind, block until it catches up
+	if (packet.m_item != NULL)
+	{
+		osd_work_item_wait(packet.m_item, osd_ticks_per_second() * 10);
+		osd_work_item_release(packet.m_item);
+		packet.m_item = NULL;
+	}
+	return packet;
+}
+
+
+//-------------------------------------------------
+//  avi_submit_packet - queue a packet to the
+//  writer, or write it directly if we have no
+//  queue
+//-------------------------------------------------
+
+void video_manager::avi_submit_packet(avi_packet &packet)
+{
+	if (m_avi_queue != NULL)
+		packet.m_item = osd_work_item_queue(m_avi_queue, avi_write_packet, &packet, 0);
+	if (packet.m_item == NULL)
+	{
+		// earlier packets may still be queued; let them land first so the
+		// file stays in order
+		avi_flush();
+		avi_write_packet(&packet, 0);
+	}
+}
+
+
+//-------------------------------------------------
+//  avi_flush - wait for all queued AVI data to be
+//  written
+//-------------------------------------------------
+
+void video_manager::avi_flush()
+{
+	if (m_avi_queue != NULL)
+		osd_work_queue_wait(m_avi_queue, osd_ticks_per_second() * 100);
+
+	for (int packetnum = 0; packetnum < AVI_PACKETS; packetnum++)
+		if (m_avi_packet[packetnum].m_item != NULL)
+		{
+			osd_work_item_release(m_avi_packet[packetnum].m_item);
+			m_avi_packet[packetnum].m_item = NULL;
+		}
+}
+
+
+//-------------------------------------------------
+//  avi_write_packet - append a packet's frame and
+//  sound to the AVI file; runs on the writer
+//  thread
+//-------------------------------------------------
+
+void *video_manager::avi_write_packet(void *param, int threadid)
+{
+	avi_packet &packet = *(avi_packet *)param;
+	video_manager &manager = *packet.m_manager;
+
+	// once an append has failed, drop everything until the file is closed
+	if (manager.m_avi_error)
+		return NULL;
+
+	// write the frame as many times as it is due
+	avi_error avierr = AVIERR_NONE;
+	for (UINT32 framenum = 0; framenum < packet.m_frames && avierr == AVIERR_NONE; framenum++)
+		avierr = avi_append_video_frame(manager.m_avi_file, packet.m_frame);
+
+	// write the sound
+	if (packet.m_samples != 0 && avierr == AVIERR_NONE)
+	{
+		avierr = avi_append_sound_samples(manager.m_avi_file, 0, &packet.m_sound[0] + 0, packet.m_samples, 1);
+		if (avierr == AVIERR_NONE)
+			avierr = avi_append_sound_samples(manager.m_avi_file, 1, &packet.m_sound[0] + 1, packet.m_samples, 1);
+	}
+
+	if (avierr != AVIERR_NONE)
+		manager.m_avi_error = true;
+	return NULL;
+}
+
+
 
 //-------------------------------------------------
 //  video_exit - close down the video system
@@ -534,10 +656,16 @@ void video_manager::exit()
 	// stop recording any movie
 	end_recording(MF_AVI);
 	end_recording(MF_MNG);
+	if (m_avi_queue != NULL)
+		osd_work_queue_free(m_avi_queue);
+	m_avi_queue = NULL;
 
 	// free the snapshot target
 	machine().render().target_free(m_snap_target);
 	m_snap_bitmap.reset();
+	if (m_snap_queue != NULL)
+		osd_work_queue_free(m_snap_queue);
+	m_snap_queue = NULL;
 
 	// print a final result if we have at least 2 seconds' worth of data
 	if (m_overall_emutime.seconds >= 1)
@@ -1095,9 +1223,9 @@ void video_manager::create_snapshot_bitmap(screen_device *screen)
 	render_primitive_list &primlist = m_snap_target->get_primitives();
 	primlist.acquire_lock();
 	if (machine().options().snap_bilinear())
-		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer_bilinear::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	else
-		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels());
+		snap_renderer::draw_primitives(primlist, &m_snap_bitmap.pix32(0), width, height, m_snap_bitmap.rowpixels(), m_snap_queue);
 	primlist.release_lock();
 }
 
@@ -1249,24 +1377,33 @@ void video_manager::record_frame()
 	// create the bitmap
 	create_snapshot_bitmap(NULL);
 
+	// stop an AVI recording if the writer hit an error
+	if (m_avi_file != NULL && m_avi_error)
+		end_recording(MF_AVI);
+
 	// handle an AVI recording
 	if (m_avi_file != NULL)
 	{
-		// loop until we hit the right time
+		// count the frames due by now
+		UINT32 frames = 0;
 		while (m_avi_next_frame_time <= curtime)
 		{
-			// write the next frame
-			avi_error avierr = avi_append_video_frame(m_avi_file, m_snap_bitmap);
-			if (avierr != AVIERR_NONE)
-			{
-				g_profiler.stop();
-				end_recording(MF_AVI);
-				break;
-			}
-
 			// advance time
 			m_avi_next_frame_time += m_avi_frame_period;
 			m_avi_frame++;
+			frames++;
+		}
+
+		// hand a copy of the frame to the writer
+		if (frames != 0)
+		{
+			avi_packet &packet = avi_next_packet();
+			if (packet.m_frame.width() != m_snap_bitmap.width() || packet.m_frame.height() != m_snap_bitmap.height())
+				packet.m_frame.allocate(m_snap_bitmap.width(), m_snap_bitmap.height());
+			copybitmap(packet.m_frame, m_snap_bitmap, 0, 0, 0, 0, m_snap_bitmap.cliprect());
+			packet.m_frames = frames;
+			packet.m_samples = 0;
+			avi_submit_packet(packet);
 		}
 	}
 
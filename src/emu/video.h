@@ -118,6 +118,24 @@ private:
 	file_error open_next(emu_file &file, const char *extension);
 	void record_frame();
 
+	// a block of AVI data handed to the writer thread
+	struct avi_packet
+	{
+		video_manager *     m_manager;                  // owning manager
+		osd_work_item *     m_item;                     // work item writing this packet, or NULL
+		bitmap_rgb32        m_frame;                    // copy of the frame to append
+		UINT32              m_frames;                   // number of times to append the frame
+		std::vector<INT16>  m_sound;                    // interleaved stereo samples to append
+		UINT32              m_samples;                  // number of samples per channel
+	};
+	static const int AVI_PACKETS = 16;              // packets in flight before recording blocks
+
+	// asynchronous AVI helpers
+	avi_packet &avi_next_packet();
+	void avi_submit_packet(avi_packet &packet);
+	void avi_flush();
+	static void *avi_write_packet(void *param, int threadid);
+
 	// internal state
 	running_machine &   m_machine;                  // reference to our machine
 
@@ -164,6 +182,7 @@ private:
 	bool                m_snap_native;              // are we using native per-screen layouts?
 	INT32               m_snap_width;               // width of snapshots (0 == auto)
 	INT32               m_snap_height;              // height of snapshots (0 == auto)
+	osd_work_queue *    m_snap_queue;               // work queue for banded snapshot rendering
 
 	// movie recording - MNG
 	auto_pointer<emu_file> m_mng_file;              // handle to the open movie file
@@ -176,6 +195,10 @@ private:
 	attotime            m_avi_frame_period;         // period of a single movie frame
 	attotime            m_avi_next_frame_time;      // time of next frame
 	UINT32              m_avi_frame;                // current movie frame number
+	osd_work_queue *    m_avi_queue;                // work queue for writing AVI data
+	avi_packet          m_avi_packet[AVI_PACKETS];  // ring of packets queued to the writer
+	int                 m_avi_packet_index;         // next packet in the ring
+	volatile bool       m_avi_error;                // set by the writer if an append failed
 
 	// movie recording - dummy
 	bool                m_dummy_recording;          // indicates if snapshot should be created of every frame
@@ -47,10 +47,10 @@
 #define KEEP_POLY_STATISTICS            0
 
 // turn this on to log the reasons for any long waits
-#define LOG_WAITS                       0
+#define POLY_LOG_WAITS                  0
 
-// number of profiling ticks before we consider a wait "long"
-#define LOG_WAIT_THRESHOLD              1000
+// number of osd ticks before we consider a wait "long"
+#define POLY_LOG_WAIT_THRESHOLD         1000
 
 
 
@@ -61,6 +61,7 @@
 #define POLYFLAG_INCLUDE_BOTTOM_EDGE        0x01
 #define POLYFLAG_INCLUDE_RIGHT_EDGE         0x02
 #define POLYFLAG_NO_WORK_QUEUE              0x04
+#define POLYFLAG_TIME_WAITS                 0x08        // time wait() calls for frame_stats
 
 #define SCANLINES_PER_BUCKET                8
 #define CACHE_LINE_SIZE                     64          // this is a general guess
@@ -121,6 +122,23 @@ public:
 	// delegate type for scanline callbacks
 	typedef delegate<void (INT32, const extent_t &, const _ObjectData &, int)> render_delegate;
 
+	// per-frame statistics, accumulated until reset_stats() is called
+	struct frame_stats
+	{
+		UINT32 polygons;                        // number of polygons queued
+		UINT32 units;                           // number of work units queued
+		UINT64 pixels;                          // number of pixels queued
+		UINT32 waits;                           // number of calls to wait()
+		osd_ticks_t wait_ticks;                 // total time spent blocked in wait() (POLYFLAG_TIME_WAITS only)
+	};
+
+	// a fence marks the work queued up to a point, for non-blocking completion checks
+	struct fence_t
+	{
+		UINT32 generation;                      // wait() generation the fence was issued in
+		UINT32 unit;                            // number of units queued when the fence was issued
+	};
+
 	// construction/destruction
 	poly_manager(running_machine &machine, UINT8 flags = 0);
 	poly_manager(screen_device &screen, UINT8 flags = 0);
@@ -132,6 +150,13 @@ public:
 
 	// synchronization
 	void wait(const char *debug_reason = "general");
+	fence_t fence() const;
+	bool fence_reached(const fence_t &fence);
+	bool idle() { return fence_reached(fence()); }
+
+	// statistics
+	const frame_stats &stats() const { return m_stats; }
+	void reset_stats() { memset(&m_stats, 0, sizeof(m_stats)); }
 
 	// object data allocators
 	_ObjectData &object_data_alloc();
@@ -250,6 +275,17 @@ private:
 		return polygon;
 	}
 
+	void queue_units(UINT32 startunit, INT32 pixels)
+	{
+		UINT32 count = m_unit.count() - startunit;
+		if (m_queue != NULL)
+			osd_work_item_queue_multiple(m_queue, work_item_callback, count, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+
+		m_stats.polygons++;
+		m_stats.units += count;
+		m_stats.pixels += pixels;
+	}
+
 	static void *work_item_callback(void *param, int threadid);
 	void presave() { wait("pre-save"); }
 
@@ -266,6 +302,10 @@ private:
 	// misc data
 	UINT8               m_flags;                    // flags
 
+	// fences
+	UINT32              m_generation;               // incremented each time wait() retires all work
+	UINT32              m_units_completed;          // units known to be complete in this generation
+
 	// buckets
 	UINT16              m_unit_bucket[TOTAL_BUCKETS]; // buckets for tracking unit usage
 
@@ -274,6 +314,7 @@ private:
 	UINT32              m_triangles;                // number of triangles queued
 	UINT32              m_quads;                    // number of quads queued
 	UINT64              m_pixels;                   // number of pixels rendered
+	frame_stats         m_stats;                    // per-frame statistics
 #if KEEP_POLY_STATISTICS
 	UINT32              m_conflicts[WORK_MAX_THREADS]; // number of conflicts found, per thread
 	UINT32              m_resolved[WORK_MAX_THREADS];   // number of conflicts resolved, per thread
@@ -294,10 +335,14 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(runnin
 		m_object(machine, *this),
 		m_unit(machine, *this),
 		m_flags(flags),
+		m_generation(0),
+		m_units_completed(0),
+		m_tiles(0),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
 {
+	reset_stats();
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
@@ -321,10 +366,14 @@ poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::poly_manager(screen
 		m_object(screen.machine(), *this),
 		m_unit(screen.machine(), *this),
 		m_flags(flags),
+		m_generation(0),
+		m_units_completed(0),
+		m_tiles(0),
 		m_triangles(0),
 		m_quads(0),
 		m_pixels(0)
 {
+	reset_stats();
 #if KEEP_POLY_STATISTICS
 	memset(m_conflicts, 0, sizeof(m_conflicts));
 	memset(m_resolved, 0, sizeof(m_resolved));
@@ -446,11 +495,9 @@ void *poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::work_item_cal
 template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
 void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const char *debug_reason)
 {
-	osd_ticks_t time;
-
-	// remember the start time if we're logging
-	if (LOG_WAITS)
-		time = get_profile_ticks();
+	// only time the wait if someone is going to look at the result
+	bool timed = (m_flags & POLYFLAG_TIME_WAITS) || POLY_LOG_WAITS;
+	osd_ticks_t time = timed ? osd_ticks() : 0;
 
 	// wait for all pending work items to complete
 	if (m_queue != NULL)
@@ -461,14 +508,25 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 		for (int unitnum = 0; unitnum < m_unit.count(); unitnum++)
 			work_item_callback(&m_unit[unitnum], 0);
 
+	// account for the time spent blocked
+	m_stats.waits++;
+	if (timed)
+	{
+		time = osd_ticks() - time;
+		m_stats.wait_ticks += time;
+	}
+
 	// log any long waits
-	if (LOG_WAITS)
+	if (POLY_LOG_WAITS)
 	{
-		time = get_profile_ticks() - time;
-		if (time > LOG_WAIT_THRESHOLD)
-			logerror("Poly:Waited %d cycles for %s\n", (int)time, debug_reason);
+		if (time > POLY_LOG_WAIT_THRESHOLD)
+			logerror("Poly:Waited %d ticks for %s\n", (int)time, debug_reason);
 	}
 
+	// everything queued so far is now complete; start a new generation
+	m_generation++;
+	m_units_completed = 0;
+
 	// reset the state
 	m_polygon.reset();
 	m_unit.reset();
@@ -486,6 +544,48 @@ void poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::wait(const cha
 }
 
 
+//-------------------------------------------------
+//  fence - return a token covering all work
+//  queued so far, for use with fence_reached()
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+typename poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::fence_t poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::fence() const
+{
+	fence_t result;
+	result.generation = m_generation;
+	result.unit = m_unit.count();
+	return result;
+}
+
+
+//-------------------------------------------------
+//  fence_reached - return true if all work queued
+//  before the given fence has completed; never
+//  blocks
+//-------------------------------------------------
+
+template<typename _BaseType, class _ObjectData, int _MaxParams, int _MaxPolys>
+bool poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::fence_reached(const fence_t &fence)
+{
+	// a wait() since the fence was issued retired everything
+	if (fence.generation != m_generation)
+		return true;
+
+	// a unit's count_next drops to 0 once all of its scanlines have been drawn
+	// (or, without a queue, only when wait() runs it); units finish out of
+	// order, so scan forward from the last one known complete
+	while (m_units_completed < fence.unit)
+	{
+		work_unit &unit = m_unit[m_units_completed];
+		if (atomic_add32((volatile INT32 *)&unit.count_next, 0) != 0)
+			return false;
+		m_units_completed++;
+	}
+	return true;
+}
+
+
 //-------------------------------------------------
 //  object_data_alloc - allocate a new _ObjectData
 //-------------------------------------------------
@@ -620,8 +720,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_tile(
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit, pixels);
 
 	// return the total number of pixels in the triangle
 	m_tiles++;
@@ -808,8 +907,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit, pixels);
 
 	// return the total number of pixels in the triangle
 	m_triangles++;
@@ -924,8 +1022,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_trian
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit, pixels);
 
 	// return the total number of pixels in the object
 	m_triangles++;
@@ -1123,8 +1220,7 @@ UINT32 poly_manager<_BaseType, _ObjectData, _MaxParams, _MaxPolys>::render_polyg
 	}
 
 	// enqueue the work items
-	if (m_queue != NULL)
-		osd_work_item_queue_multiple(m_queue, work_item_callback, m_unit.count() - startunit, &m_unit[startunit], m_unit.itemsize(), WORK_ITEM_FLAG_AUTO_RELEASE);
+	queue_units(startunit, pixels);
 
 	// return the total number of pixels in the triangle
 	m_quads++;
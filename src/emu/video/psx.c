@@ -923,8 +923,6 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 	} \
 	TRANSPARENCYSETUP
 
-#define FLATPOLYGONUPDATE
-#define FLATRECTANGEUPDATE
 #define GOURAUDPOLYGONUPDATE \
 	n_r.d += n_dr; \
 	n_g.d += n_dg; \
@@ -967,6 +965,51 @@ void psxgpu_device::decode_tpage( UINT32 tpage )
 		break; \
 	}
 
+/* flat shaded spans have the same source colour at every pixel, so look
+   the shade tables up once per span instead of once per pixel */
+#define FLATFILL \
+	if( n_distance > ( (INT32)n_drawarea_x2 - drawx ) + 1 ) \
+	{ \
+		n_distance = ( n_drawarea_x2 - drawx ) + 1; \
+	} \
+	p_vram = p_p_vram[ drawy ] + drawx; \
+	\
+	switch( n_cmd & 0x02 ) \
+	{ \
+	case 0x00: \
+		/* transparency off */ \
+		{ \
+			UINT16 n_pixel = \
+				p_n_redshade[ MID_LEVEL | n_r.w.h ] | \
+				p_n_greenshade[ MID_LEVEL | n_g.w.h ] | \
+				p_n_blueshade[ MID_LEVEL | n_b.w.h ]; \
+			while( n_distance > 0 ) \
+			{ \
+				WRITE_PIXEL( n_pixel ); \
+				p_vram++; \
+				n_distance--; \
+			} \
+		} \
+		break; \
+	case 0x02: \
+		/* transparency on */ \
+		{ \
+			UINT16 n_redf = p_n_f[ MID_LEVEL | n_r.w.h ]; \
+			UINT16 n_greenf = p_n_f[ MID_LEVEL | n_g.w.h ]; \
+			UINT16 n_bluef = p_n_f[ MID_LEVEL | n_b.w.h ]; \
+			while( n_distance > 0 ) \
+			{ \
+				WRITE_PIXEL( \
+					p_n_redtrans[ n_redf | p_n_redb[ *( p_vram ) ] ] | \
+					p_n_greentrans[ n_greenf | p_n_greenb[ *( p_vram ) ] ] | \
+					p_n_bluetrans[ n_bluef | p_n_blueb[ *( p_vram ) ] ] ); \
+				p_vram++; \
+				n_distance--; \
+			} \
+		} \
+		break; \
+	}
+
 #define FLATTEXTUREDPOLYGONUPDATE \
 	n_u.d += n_du; \
 	n_v.d += n_dv;
@@ -1484,7 +1527,7 @@ void psxgpu_device::FlatPolygon( int n_points )
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATPOLYGONUPDATE )
+			FLATFILL
 		}
 		n_cx1.d += n_dx1;
 		n_cx2.d += n_dx2;
@@ -2393,6 +2436,7 @@ void psxgpu_device::FrameBufferRectangleDraw( void )
 	INT16 n_y;
 	INT16 n_x;
 	UINT16 *p_vram;
+	UINT16 n_pixel;
 
 #if DEBUG_VIEWER
 	if( m_debug.n_skip == 7 )
@@ -2410,6 +2454,11 @@ void psxgpu_device::FrameBufferRectangleDraw( void )
 	n_g.w.h = BGR_G( m_packet.FlatRectangle.n_bgr ); n_g.w.l = 0;
 	n_b.w.h = BGR_B( m_packet.FlatRectangle.n_bgr ); n_b.w.l = 0;
 
+	n_pixel =
+		p_n_redshade[ MID_LEVEL | n_r.w.h ] |
+		p_n_greenshade[ MID_LEVEL | n_g.w.h ] |
+		p_n_blueshade[ MID_LEVEL | n_b.w.h ];
+
 	n_y = COORD_Y( m_packet.FlatRectangle.n_coord );
 	n_h = SIZE_H( m_packet.FlatRectangle.n_size );
 
@@ -2421,10 +2470,7 @@ void psxgpu_device::FrameBufferRectangleDraw( void )
 		while( n_distance > 0 )
 		{
 			p_vram = p_p_vram[ n_y & 1023 ] + ( n_x & 1023 );
-			WRITE_PIXEL(
-				p_n_redshade[ MID_LEVEL | n_r.w.h ] |
-				p_n_greenshade[ MID_LEVEL | n_g.w.h ] |
-				p_n_blueshade[ MID_LEVEL | n_b.w.h ] );
+			WRITE_PIXEL( n_pixel );
 			n_x++;
 			n_distance--;
 		}
@@ -2496,7 +2542,7 @@ void psxgpu_device::FlatRectangle( void )
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 		n_y++;
 		n_h--;
@@ -2566,7 +2612,7 @@ void psxgpu_device::FlatRectangle8x8( void )
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 		n_y++;
 		n_h--;
@@ -2636,7 +2682,7 @@ void psxgpu_device::FlatRectangle16x16( void )
 				drawx = n_drawarea_x1;
 			}
 
-			SOLIDFILL( FLATRECTANGEUPDATE )
+			FLATFILL
 		}
 		n_y++;
 		n_h--;
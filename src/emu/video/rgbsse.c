@@ -160,67 +160,4 @@ const struct rgbaint_t::_statics rgbaint_t::statics =
 };
 
 
-/***************************************************************************
-    HIGHER LEVEL OPERATIONS
-***************************************************************************/
-
-void rgbaint_t::blend(const rgbaint_t& other, UINT8 factor)
-{
-	__m128i scale1 = _mm_set1_epi32(factor);
-	__m128i scale2 = _mm_sub_epi32(_mm_set1_epi32(0x100), scale1);
-
-	rgbaint_t scaled_other(other);
-	scaled_other.mul(scale2);
-
-	mul(scale1);
-	add(scaled_other);
-	sra(8);
-}
-
-void rgbaint_t::scale_and_clamp(const rgbaint_t& scale)
-{
-	mul(scale);
-	sra(8);
-	max(0);
-	min(255);
-}
-
-void rgbaint_t::scale_imm_and_clamp(const INT32 scale)
-{
-	mul_imm(scale);
-	sra(8);
-	max(0);
-	min(255);
-}
-
-void rgbaint_t::scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other, const rgbaint_t& scale2)
-{
-	rgbaint_t color2(other);
-	color2.mul(scale2);
-
-	mul(scale);
-	add(color2);
-	sra(8);
-	max(0);
-	min(255);
-}
-
-void rgbaint_t::scale_imm_add_and_clamp(const INT32 scale, const rgbaint_t& other)
-{
-	mul_imm(scale);
-	sra(8);
-	add(other);
-	max(0);
-	min(255);
-}
-
-void rgbaint_t::scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other)
-{
-	mul(scale);
-	sra(8);
-	add(other);
-	max(0);
-	min(255);
-}
-
 #endif // defined(__SSE2__) || defined(_MSC_VER)
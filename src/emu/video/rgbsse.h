@@ -337,13 +337,62 @@ public:
 		m_value = _mm_or_si128(val_to_set, m_value);
 	}
 
-	void blend(const rgbaint_t& other, UINT8 factor);
+	// these are called per pixel by the 3D rasterizers, so they live here where
+	// they can be inlined; note that sra_imm is required, since sra(8) would
+	// build a per-channel shift vector that only shifts blue
+	inline void blend(const rgbaint_t& other, UINT8 factor)
+	{
+		__m128i scale1 = _mm_set1_epi32(factor);
+		__m128i scale2 = _mm_sub_epi32(_mm_set1_epi32(0x100), scale1);
+
+		rgbaint_t scaled_other(other);
+		scaled_other.mul(scale2);
+
+		mul(scale1);
+		add(scaled_other);
+		sra_imm(8);
+	}
+
+	inline void scale_and_clamp(const rgbaint_t& scale)
+	{
+		mul(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_and_clamp(const INT32 scale)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
 
-	void scale_and_clamp(const rgbaint_t& scale);
-	void scale_imm_and_clamp(const INT32 scale);
-	void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other, const rgbaint_t& scale2);
-	void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other);
-	void scale_imm_add_and_clamp(const INT32 scale, const rgbaint_t& other);
+	inline void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other, const rgbaint_t& scale2)
+	{
+		rgbaint_t color2(other);
+		color2.mul(scale2);
+
+		mul(scale);
+		add(color2);
+		sra_imm(8);
+		clamp_to_uint8();
+	}
+
+	inline void scale_add_and_clamp(const rgbaint_t& scale, const rgbaint_t& other)
+	{
+		mul(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
+
+	inline void scale_imm_add_and_clamp(const INT32 scale, const rgbaint_t& other)
+	{
+		mul_imm(scale);
+		sra_imm(8);
+		add(other);
+		clamp_to_uint8();
+	}
 
 	inline void cmpeq(const rgbaint_t& value)
 	{
@@ -1815,6 +1815,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 	UINT16 ii;
 	int x;
 	int fade;
+	UINT8 fade_lut[32];
 	struct SNES_SCANLINE *scanline1, *scanline2;
 	UINT16 c;
 	UINT16 prev_colour = 0;
@@ -1887,13 +1888,17 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 
 		/* Draw the scanline to screen */
 
+		/* brightness is constant along the line, so apply it (and the 5 to 8 bit expansion) through a small table */
 		fade = m_screen_brightness;
+		for (x = 0; x < 32; x++)
+			fade_lut[x] = pal5bit((x * fade) >> 4);
+
+		UINT32 *dest = &bitmap.pix32(curline);
+		int hires = (m_mode != 5 && m_mode != 6 && !m_pseudo_hires) ? 0 : 1;
 
 		for (x = 0; x < SNES_SCR_WIDTH; x++)
 		{
-			int r, g, b, hires;
 			UINT16 tmp_col[2];
-			hires = (m_mode != 5 && m_mode != 6 && !m_pseudo_hires) ? 0 : 1;
 
 			/* in hires, the first pixel (of 512) is subscreen pixel, then the first mainscreen pixel follows, and so on... */
 			if (!hires)
@@ -1904,12 +1909,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				if (!scanline1->blend_exception[x] && m_layer[scanline1->layer[x]].color_math)
 					draw_blend(x, &c, m_prevent_color_math, m_clip_to_black, 0);
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
-
-				bitmap.pix32(curline, x * 2 + 0) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
-				bitmap.pix32(curline, x * 2 + 1) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				dest[x * 2 + 0] = dest[x * 2 + 1] = rgb_t(fade_lut[c & 0x1f], fade_lut[(c & 0x3e0) >> 5], fade_lut[(c & 0x7c00) >> 10]);
 			}
 			else
 			{
@@ -1943,11 +1943,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				else
 					c = tmp_col[0];
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
-
-				bitmap.pix32(curline, x * 2 + 0) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				dest[x * 2 + 0] = rgb_t(fade_lut[c & 0x1f], fade_lut[(c & 0x3e0) >> 5], fade_lut[(c & 0x7c00) >> 10]);
 				prev_colour = tmp_col[0];
 
 				/* average the second pixel if required, or draw it directly*/
@@ -1956,11 +1952,7 @@ void snes_ppu_device::refresh_scanline( bitmap_rgb32 &bitmap, UINT16 curline )
 				else
 					c = tmp_col[1];
 
-				r = ((c & 0x1f) * fade) >> 4;
-				g = (((c & 0x3e0) >> 5) * fade) >> 4;
-				b = (((c & 0x7c00) >> 10) * fade) >> 4;
-
-				bitmap.pix32(curline, x * 2 + 1) = rgb_t(pal5bit(r), pal5bit(g), pal5bit(b));
+				dest[x * 2 + 1] = rgb_t(fade_lut[c & 0x1f], fade_lut[(c & 0x3e0) >> 5], fade_lut[(c & 0x7c00) >> 10]);
 				prev_colour = tmp_col[1];
 			}
 		}
@@ -6352,20 +6352,22 @@ int saturn_state::get_window_pixel(int s_x,int e_x,int s_y,int e_y,int x, int y,
 	return res;
 }
 
+void saturn_state::stv_vdp2_latch_window_coordinates( void )
+{
+	stv_vdp2_get_window0_coordinates(&m_vdp2_window[0].s_x, &m_vdp2_window[0].e_x, &m_vdp2_window[0].s_y, &m_vdp2_window[0].e_y);
+	stv_vdp2_get_window1_coordinates(&m_vdp2_window[1].s_x, &m_vdp2_window[1].e_x, &m_vdp2_window[1].s_y, &m_vdp2_window[1].e_y);
+}
+
 inline int saturn_state::stv_vdp2_window_process(int x,int y)
 {
-	int s_x=0,e_x=0,s_y=0,e_y=0;
 	int w0_pix, w1_pix;
 
 	if (stv2_current_tilemap.window_control.enabled[0] == 0 &&
 		stv2_current_tilemap.window_control.enabled[1] == 0)
 		return 1;
 
-	stv_vdp2_get_window0_coordinates(&s_x, &e_x, &s_y, &e_y);
-	w0_pix = get_window_pixel(s_x,e_x,s_y,e_y,x,y,0);
-
-	stv_vdp2_get_window1_coordinates(&s_x, &e_x, &s_y, &e_y);
-	w1_pix = get_window_pixel(s_x,e_x,s_y,e_y,x,y,1);
+	w0_pix = get_window_pixel(m_vdp2_window[0].s_x,m_vdp2_window[0].e_x,m_vdp2_window[0].s_y,m_vdp2_window[0].e_y,x,y,0);
+	w1_pix = get_window_pixel(m_vdp2_window[1].s_x,m_vdp2_window[1].e_x,m_vdp2_window[1].s_y,m_vdp2_window[1].e_y,x,y,1);
 
 	return stv2_current_tilemap.window_control.logic & 1 ? (w0_pix | w1_pix) : (w0_pix & w1_pix);
 }
@@ -6929,6 +6931,7 @@ void saturn_state::draw_sprites(bitmap_rgb32 &bitmap, const rectangle &cliprect,
 UINT32 saturn_state::screen_update_stv_vdp2(screen_device &screen, bitmap_rgb32 &bitmap, const rectangle &cliprect)
 {
 	stv_vdp2_fade_effects();
+	stv_vdp2_latch_window_coordinates();
 
 	stv_vdp2_draw_back(m_tmpbitmap,cliprect);
 
@@ -1363,6 +1363,7 @@ static const UINT8 dither_matrix_2x2[16] =
 
 struct voodoo_state;
 struct poly_extra_data;
+struct raster_info;
 
 
 struct rgba
@@ -1611,28 +1612,11 @@ struct dac_state
 };
 
 
-struct raster_info
-{
-	raster_info *       next;                   /* pointer to next entry with the same hash */
-	poly_draw_scanline_func callback;           /* callback pointer */
-	UINT8               is_generic;             /* TRUE if this is one of the generic rasterizers */
-	UINT8               display;                /* display index */
-	UINT32              hits;                   /* how many hits (pixels) we've used this for */
-	UINT32              polys;                  /* how many polys we've used this for */
-	UINT32              eff_color_path;         /* effective fbzColorPath value */
-	UINT32              eff_alpha_mode;         /* effective alphaMode value */
-	UINT32              eff_fog_mode;           /* effective fogMode value */
-	UINT32              eff_fbz_mode;           /* effective fbzMode value */
-	UINT32              eff_tex_mode_0;         /* effective textureMode value for TMU #0 */
-	UINT32              eff_tex_mode_1;         /* effective textureMode value for TMU #1 */
-	UINT32              hash;
-};
-
-
 struct poly_extra_data
 {
 	voodoo_state *      state;                  /* pointer back to the voodoo state */
 	raster_info *       info;                   /* pointer to rasterizer information */
+	UINT16 *            destbase;               /* base of the buffer being drawn */
 
 	INT16               ax, ay;                 /* vertex A x,y (12.4) */
 	INT32               startr, startg, startb, starta; /* starting R,G,B,A (12.12) */
@@ -1665,6 +1649,35 @@ struct poly_extra_data
 };
 
 
+class voodoo_renderer : public poly_manager<float, poly_extra_data, 1, 64>
+{
+public:
+	voodoo_renderer(running_machine &machine)
+		: poly_manager<float, poly_extra_data, 1, 64>(machine) { }
+};
+
+typedef voodoo_renderer::extent_t poly_extent;
+typedef void (*voodoo_raster_func)(voodoo_state *v, INT32 scanline, const poly_extent &extent, const poly_extra_data &extra, int threadid);
+
+
+struct raster_info
+{
+	raster_info *       next;                   /* pointer to next entry with the same hash */
+	voodoo_raster_func  callback;               /* callback pointer */
+	UINT8               is_generic;             /* TRUE if this is one of the generic rasterizers */
+	UINT8               display;                /* display index */
+	UINT32              hits;                   /* how many hits (pixels) we've used this for */
+	UINT32              polys;                  /* how many polys we've used this for */
+	UINT32              eff_color_path;         /* effective fbzColorPath value */
+	UINT32              eff_alpha_mode;         /* effective alphaMode value */
+	UINT32              eff_fog_mode;           /* effective fogMode value */
+	UINT32              eff_fbz_mode;           /* effective fbzMode value */
+	UINT32              eff_tex_mode_0;         /* effective textureMode value for TMU #0 */
+	UINT32              eff_tex_mode_1;         /* effective textureMode value for TMU #1 */
+	UINT32              hash;
+};
+
+
 struct banshee_info
 {
 	UINT32              io[0x40];               /* I/O registers */
@@ -1721,7 +1734,7 @@ struct voodoo_state
 	tmu_shared_state    tmushare;               /* TMU shared state */
 	banshee_info        banshee;                /* Banshee state */
 
-	legacy_poly_manager * poly;                 /* polygon manager */
+	voodoo_renderer *   poly;                   /* polygon manager */
 	stats_block *       thread_stats;           /* per-thread statistics */
 
 	voodoo_stats        stats;                  /* internal statistics */
@@ -4414,14 +4427,14 @@ INLINE bool ATTR_FORCE_INLINE combineColor(voodoo_state *VV, stats_block *STATS,
 #if USE_OLD_RASTER == 1
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid) \
+static void raster_##name(voodoo_state *v, INT32 y, const poly_extent &extent, const poly_extra_data &extradata, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
-	voodoo_state *v = extra->state;                                             \
+	const poly_extra_data *extra = &extradata;                                  \
+	void *destbase = extra->destbase;                                           \
 	stats_block *stats = &v->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
-	INT32 startx = extent->startx;                                              \
-	INT32 stopx = extent->stopx;                                                \
+	INT32 startx = extent.startx;                                               \
+	INT32 stopx = extent.stopx;                                                 \
 	INT32 iterr, iterg, iterb, itera;                                           \
 	INT32 iterz;                                                                \
 	INT64 iterw, iterw0 = 0, iterw1 = 0;                                        \
@@ -4562,14 +4575,14 @@ static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, co
 // New rasterizer implementation
 #define RASTERIZER(name, TMUS, FBZCOLORPATH, FBZMODE, ALPHAMODE, FOGMODE, TEXMODE0, TEXMODE1) \
 																				\
-static void raster_##name(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid) \
+static void raster_##name(voodoo_state *v, INT32 y, const poly_extent &extent, const poly_extra_data &extradata, int threadid) \
 {                                                                               \
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;          \
-	voodoo_state *v = extra->state;                                             \
+	const poly_extra_data *extra = &extradata;                                  \
+	void *destbase = extra->destbase;                                           \
 	stats_block *stats = &v->thread_stats[threadid];                            \
 	DECLARE_DITHER_POINTERS;                                                    \
-	INT32 startx = extent->startx;                                              \
-	INT32 stopx = extent->stopx;                                                \
+	INT32 startx = extent.startx;                                               \
+	INT32 stopx = extent.stopx;                                                 \
 	rgbaint_t iterargb, iterargbDelta;                                           \
 	INT32 iterz;                                                                \
 	INT64 iterw, iterw0 = 0, iterw1 = 0;                                        \
@@ -145,7 +145,7 @@ bits(7:4) and bit(24)), X, and Y:
 #define EXPAND_RASTERIZERS
 
 #include "emu.h"
-#include "video/polylgcy.h"
+#include "video/poly.h"
 #include "video/rgbutil.h"
 #include "voodoo.h"
 #include "vooddefs.h"
@@ -233,10 +233,8 @@ static raster_info *find_rasterizer(voodoo_state *v, int texcount);
 static void dump_rasterizer_stats(voodoo_state *v);
 
 /* generic rasterizers */
-static void raster_fastfill(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_0tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_1tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
-static void raster_generic_2tmu(void *dest, INT32 scanline, const poly_extent *extent, const void *extradata, int threadid);
+static void raster_fastfill(voodoo_state *v, INT32 scanline, const poly_extent &extent, const poly_extra_data &extra, int threadid);
+static voodoo_raster_func generic_rasterizer(int texcount, UINT32 fbzmode, UINT32 alphamode, UINT32 fogmode);
 
 
 
@@ -2469,21 +2467,21 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* mask off invalid bits for different cards */
 		case fbzColorPath:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0fffffff;
 			if (chips & 1) v->reg[fbzColorPath].u = data;
 			break;
 
 		case fbzMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x001fffff;
 			if (chips & 1) v->reg[fbzMode].u = data;
 			break;
 
 		case fogMode:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type < TYPE_VOODOO_2)
 				data &= 0x0000003f;
 			if (chips & 1) v->reg[fogMode].u = data;
@@ -2512,7 +2510,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* other commands */
 		case nopCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (data & 1)
 				reset_counters(v);
 			if (data & 2)
@@ -2524,12 +2522,12 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case swapbufferCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			cycles = swapbuffer(v, data);
 			break;
 
 		case userIntrCMD:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			//fatalerror("userIntrCMD\n");
 
 			v->reg[intrCtrl].u |= 0x1800;
@@ -2544,7 +2542,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case clutData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!FBIINIT1_VIDEO_TIMING_RESET(v->reg[fbiInit1].u))
 				{
 					int index = data >> 24;
@@ -2563,7 +2561,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case dacData:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				if (!(data & 0x800))
 					dacdata_w(&v->dac, (data >> 8) & 7, data & 0xff);
 				else
@@ -2578,7 +2576,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case videoDimensions:
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				if (v->reg[hSync].u != 0 && v->reg[vSync].u != 0 && v->reg[videoDimensions].u != 0)
 				{
@@ -2667,7 +2665,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 
 		/* fbiInit0 can only be written if initEnable says we can -- Voodoo/Voodoo2 only */
 		case fbiInit0:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[fbiInit0].u = data;
@@ -2691,7 +2689,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fbiInit1:
 		case fbiInit2:
 		case fbiInit4:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2701,7 +2699,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 			break;
 
 		case fbiInit3:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (v->type <= TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
 				v->reg[regnum].u = data;
@@ -2715,7 +2713,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 /*      case swapPending: -- Banshee */
 			if (v->type == TYPE_VOODOO_2 && (chips & 1) && INITEN_ENABLE_HW_INIT(v->pci.init_enable))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].enable = FBIINIT7_CMDFIFO_ENABLE(data);
 				v->fbi.cmdfifo[0].count_holes = !FBIINIT7_DISABLE_CMDFIFO_HOLES(data);
@@ -2728,7 +2726,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case cmdFifoBaseAddr:
 			if (v->type == TYPE_VOODOO_2 && (chips & 1))
 			{
-				poly_wait(v->poly, v->regnames[regnum]);
+				v->poly->wait(v->regnames[regnum]);
 				v->reg[regnum].u = data;
 				v->fbi.cmdfifo[0].base = (data & 0x3ff) << 12;
 				v->fbi.cmdfifo[0].end = (((data >> 16) & 0x3ff) + 1) << 12;
@@ -2804,7 +2802,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+9:
 		case nccTable+10:
 		case nccTable+11:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[0], regnum - nccTable, data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[0], regnum - nccTable, data);
 			break;
@@ -2821,7 +2819,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case nccTable+21:
 		case nccTable+22:
 		case nccTable+23:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2) ncc_table_write(&v->tmu[0].ncc[1], regnum - (nccTable+12), data);
 			if (chips & 4) ncc_table_write(&v->tmu[1].ncc[1], regnum - (nccTable+12), data);
 			break;
@@ -2859,7 +2857,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case fogTable+29:
 		case fogTable+30:
 		case fogTable+31:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 1)
 			{
 				int base = 2 * (regnum - fogTable);
@@ -2878,7 +2876,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case texBaseAddr_1:
 		case texBaseAddr_2:
 		case texBaseAddr_3_8:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			if (chips & 2)
 			{
 				v->tmu[0].reg[regnum].u = data;
@@ -2907,7 +2905,7 @@ static INT32 register_w(voodoo_state *v, offs_t offset, UINT32 data)
 		case color0:
 		case clipLowYHighY:
 		case clipLeftRight:
-			poly_wait(v->poly, v->regnames[regnum]);
+			v->poly->wait(v->regnames[regnum]);
 			/* fall through to default implementation */
 
 		/* by default, just feed the data to the chips */
@@ -3235,7 +3233,7 @@ static INT32 lfb_w(voodoo_state *v, offs_t offset, UINT32 data, UINT32 mem_mask)
 		COMPUTE_DITHER_POINTERS_NO_DITHER_VAR(v->reg[fbzMode].u, y);
 
 		/* wait for any outstanding work to finish */
-		poly_wait(v->poly, "LFB Write");
+		v->poly->wait("LFB Write");
 
 		/* loop over up to two pixels */
 		for (pix = 0; mask; pix++)
@@ -3407,7 +3405,7 @@ static INT32 lfb_w(voodoo_state *v, offs_t offset, UINT32 data, UINT32 mem_mask)
 				#endif
 
 				/* wait for any outstanding work to finish */
-				poly_wait(v->poly, "LFB Write");
+				v->poly->wait("LFB Write");
 
 				/* pixel pipeline part 2 handles color combine, fog, alpha, and final output */
 				PIXEL_PIPELINE_END(v, stats, dither, dither4, dither_lookup, x, dest, depth,
@@ -3448,7 +3446,7 @@ static INT32 texture_w(voodoo_state *v, offs_t offset, UINT32 data)
 		fatalerror("Texture direct write!\n");
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "Texture write");
+	v->poly->wait("Texture write");
 
 	/* update texture info if dirty */
 	if (t->regdirty)
@@ -4103,7 +4101,7 @@ static UINT32 lfb_r(voodoo_state *v, offs_t offset, bool lfb_3d)
 	}
 
 	/* wait for any outstanding work to finish */
-	poly_wait(v->poly, "LFB read");
+	v->poly->wait("LFB read");
 
 	/* compute the data */
 	data = buffer[bufoffs + 0] | (buffer[bufoffs + 1] << 16);
@@ -5033,7 +5031,7 @@ void voodoo_device::common_start_voodoo(UINT8 type)
 	v->device->m_stall.resolve();
 
 	/* create a multiprocessor work queue */
-	v->poly = poly_alloc(machine(), 64, sizeof(poly_extra_data), 0);
+	v->poly = auto_alloc(machine(), voodoo_renderer(machine()));
 	v->thread_stats = auto_alloc_array(machine(), stats_block, WORK_MAX_THREADS);
 
 	/* create a table of precomputed 1/n and log2(n) values */
@@ -5269,13 +5267,14 @@ static INT32 fastfill(voodoo_state *v)
 	/* iterate over blocks of extents */
 	for (y = sy; y < ey; y += ARRAY_LENGTH(extents))
 	{
-		poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+		poly_extra_data &extra = v->poly->object_data_alloc();
 		int count = MIN(ey - y, ARRAY_LENGTH(extents));
 
-		extra->state = v;
-		memcpy(extra->dither, dithermatrix, sizeof(extra->dither));
+		extra.state = v;
+		extra.destbase = drawbuf;
+		memcpy(extra.dither, dithermatrix, sizeof(extra.dither));
 
-		pixels += poly_render_triangle_custom(v->poly, drawbuf, global_cliprect, raster_fastfill, y, count, extents);
+		pixels += v->poly->render_triangle_custom(global_cliprect, voodoo_renderer::render_delegate(FUNC(raster_fastfill), v), y, count, extents);
 	}
 
 	/* 2 pixels per clock */
@@ -5363,7 +5362,7 @@ static INT32 triangle(voodoo_state *v)
 	}
 
 	/* wait for any outstanding work to finish */
-//  poly_wait(v->poly, "triangle");
+//  v->poly->wait("triangle");
 
 	/* determine the draw buffer */
 	destbuf = (v->type >= TYPE_VOODOO_BANSHEE) ? 1 : FBZMODE_DRAW_BUFFER(v->reg[fbzMode].u);
@@ -5610,9 +5609,9 @@ static INT32 setup_and_draw_triangle(voodoo_state *v)
 
 static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int texcount)
 {
-	poly_extra_data *extra = (poly_extra_data *)poly_get_extra_data(v->poly);
+	poly_extra_data *extra = &v->poly->object_data_alloc();
 	raster_info *info = find_rasterizer(v, texcount);
-	poly_vertex vert[3];
+	voodoo_renderer::vertex_t vert[3];
 
 	/* fill in the vertex data */
 	vert[0].x = (float)v->fbi.ax * (1.0f / 16.0f);
@@ -5625,6 +5624,7 @@ static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int tex
 	/* fill in the extra data */
 	extra->state = v;
 	extra->info = info;
+	extra->destbase = drawbuf;
 
 	/* fill in triangle parameters */
 	extra->ax = v->fbi.ax;
@@ -5682,7 +5682,7 @@ static INT32 triangle_create_work_item(voodoo_state *v, UINT16 *drawbuf, int tex
 
 	/* farm the rasterization out to other threads */
 	info->polys++;
-	return poly_render_triangle(v->poly, drawbuf, global_cliprect, info->callback, 0, &vert[0], &vert[1], &vert[2]);
+	return v->poly->render_triangle(global_cliprect, voodoo_renderer::render_delegate(info->callback, "raster", v), 0, vert[0], vert[1], vert[2]);
 }
 
 
@@ -5770,7 +5770,7 @@ static raster_info *find_rasterizer(voodoo_state *v, int texcount)
 		}
 
 	/* generate a new one using the generic entry */
-	curinfo.callback = (texcount == 0) ? raster_generic_0tmu : (texcount == 1) ? raster_generic_1tmu : raster_generic_2tmu;
+	curinfo.callback = generic_rasterizer(texcount, v->reg[fbzMode].u, v->reg[alphaMode].u, v->reg[fogMode].u);
 	curinfo.is_generic = TRUE;
 	curinfo.display = 0;
 	curinfo.polys = 0;
@@ -5877,7 +5877,11 @@ void voodoo_device::device_stop()
 
 	/* release the work queue, ensuring all work is finished */
 	if (v->poly != NULL)
-		poly_free(v->poly);
+	{
+		v->poly->wait("device_stop");
+		auto_free(machine(), v->poly);
+		v->poly = NULL;
+	}
 }
 
 
@@ -5964,13 +5968,11 @@ void voodoo_3_device::device_start()
     implementation of the 'fastfill' command
 -------------------------------------------------*/
 
-static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent, const void *extradata, int threadid)
+static void raster_fastfill(voodoo_state *v, INT32 y, const poly_extent &extent, const poly_extra_data &extra, int threadid)
 {
-	const poly_extra_data *extra = (const poly_extra_data *)extradata;
-	voodoo_state *v = extra->state;
 	stats_block *stats = &v->thread_stats[threadid];
-	INT32 startx = extent->startx;
-	INT32 stopx = extent->stopx;
+	INT32 startx = extent.startx;
+	INT32 stopx = extent.stopx;
 	int scry, x;
 
 	/* determine the screen Y */
@@ -5981,9 +5983,9 @@ static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent,
 	/* fill this RGB row */
 	if (FBZMODE_RGB_BUFFER_MASK(v->reg[fbzMode].u))
 	{
-		const UINT16 *ditherow = &extra->dither[(y & 3) * 4];
+		const UINT16 *ditherow = &extra.dither[(y & 3) * 4];
 		UINT64 expanded = *(UINT64 *)ditherow;
-		UINT16 *dest = (UINT16 *)destbase + scry * v->fbi.rowpixels;
+		UINT16 *dest = extra.destbase + scry * v->fbi.rowpixels;
 
 		for (x = startx; x < stopx && (x & 3) != 0; x++)
 			dest[x] = ditherow[x & 3];
@@ -6012,27 +6014,64 @@ static void raster_fastfill(void *destbase, INT32 y, const poly_extent *extent,
 
 
 /*-------------------------------------------------
-    generic_0tmu - generic rasterizer for 0 TMUs
+    generic rasterizers - used for any mode not
+    in the table above; the depth buffer, alpha
+    blend, alpha test and fog enables are folded
+    in as constants so that each variant only
+    carries the pipeline stages it needs
 -------------------------------------------------*/
 
-RASTERIZER(generic_0tmu, 0, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, 0, 0)
+#define GENERIC_FBZMODE(k)      ((v->reg[fbzMode].u & ~0x10) | (((k) & 1) << 4))
+#define GENERIC_ALPHAMODE(k)    ((v->reg[alphaMode].u & ~0x11) | ((((k) >> 1) & 1) << 4) | (((k) >> 2) & 1))
+#define GENERIC_FOGMODE(k)      ((v->reg[fogMode].u & ~0x01) | (((k) >> 3) & 1))
+
+#define GENERIC_RASTERIZERS(k) \
+RASTERIZER(generic_0tmu_##k, 0, v->reg[fbzColorPath].u, GENERIC_FBZMODE(k), GENERIC_ALPHAMODE(k), \
+			GENERIC_FOGMODE(k), 0, 0) \
+RASTERIZER(generic_1tmu_##k, 1, v->reg[fbzColorPath].u, GENERIC_FBZMODE(k), GENERIC_ALPHAMODE(k), \
+			GENERIC_FOGMODE(k), v->tmu[0].reg[textureMode].u, 0) \
+RASTERIZER(generic_2tmu_##k, 2, v->reg[fbzColorPath].u, GENERIC_FBZMODE(k), GENERIC_ALPHAMODE(k), \
+			GENERIC_FOGMODE(k), v->tmu[0].reg[textureMode].u, v->tmu[1].reg[textureMode].u)
+
+GENERIC_RASTERIZERS(0)
+GENERIC_RASTERIZERS(1)
+GENERIC_RASTERIZERS(2)
+GENERIC_RASTERIZERS(3)
+GENERIC_RASTERIZERS(4)
+GENERIC_RASTERIZERS(5)
+GENERIC_RASTERIZERS(6)
+GENERIC_RASTERIZERS(7)
+GENERIC_RASTERIZERS(8)
+GENERIC_RASTERIZERS(9)
+GENERIC_RASTERIZERS(10)
+GENERIC_RASTERIZERS(11)
+GENERIC_RASTERIZERS(12)
+GENERIC_RASTERIZERS(13)
+GENERIC_RASTERIZERS(14)
+GENERIC_RASTERIZERS(15)
 
 
 /*-------------------------------------------------
-    generic_1tmu - generic rasterizer for 1 TMU
+    generic_rasterizer - select the generic
+    rasterizer variant for the given modes
 -------------------------------------------------*/
 
-RASTERIZER(generic_1tmu, 1, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, v->tmu[0].reg[textureMode].u, 0)
-
+#define GENERIC_ENTRY(k) { raster_generic_0tmu_##k, raster_generic_1tmu_##k, raster_generic_2tmu_##k }
 
-/*-------------------------------------------------
-    generic_2tmu - generic rasterizer for 2 TMUs
--------------------------------------------------*/
-
-RASTERIZER(generic_2tmu, 2, v->reg[fbzColorPath].u, v->reg[fbzMode].u, v->reg[alphaMode].u,
-			v->reg[fogMode].u, v->tmu[0].reg[textureMode].u, v->tmu[1].reg[textureMode].u)
+static voodoo_raster_func generic_rasterizer(int texcount, UINT32 fbzmode, UINT32 alphamode, UINT32 fogmode)
+{
+	static const voodoo_raster_func generic_table[16][3] =
+	{
+		GENERIC_ENTRY(0),  GENERIC_ENTRY(1),  GENERIC_ENTRY(2),  GENERIC_ENTRY(3),
+		GENERIC_ENTRY(4),  GENERIC_ENTRY(5),  GENERIC_ENTRY(6),  GENERIC_ENTRY(7),
+		GENERIC_ENTRY(8),  GENERIC_ENTRY(9),  GENERIC_ENTRY(10), GENERIC_ENTRY(11),
+		GENERIC_ENTRY(12), GENERIC_ENTRY(13), GENERIC_ENTRY(14), GENERIC_ENTRY(15)
+	};
+	int index = FBZMODE_ENABLE_DEPTHBUF(fbzmode) | (ALPHAMODE_ALPHABLEND(alphamode) << 1) |
+				(ALPHAMODE_ALPHATEST(alphamode) << 2) | (FOGMODE_ENABLE_FOG(fogmode) << 3);
+
+	return generic_table[index][texcount];
+}
 
 
 #else
@@ -0,0 +1,45 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    srlfile.h
+
+    Sound chip register write log (.srl) format, shared by the emulator,
+    which writes these logs with -soundlog, and the srldump tool.
+
+    All values are little-endian:
+
+        header: "SRL\0", UINT32 version, UINT32 sample rate, UINT32 clock
+        record: UINT64 sample number, UINT32 offset, UINT32 data
+
+    Sample numbers always count at the header's sample rate, which is the
+    stream's rate when the log was opened.
+
+    Offsets at or above SRL_PSEUDO_OFFSET are not bus writes; they record
+    device-specific state changes (bank switches, pin changes) that affect
+    the output, with the new value in the data field. SRL_RATE_CHANGE
+    records that the stream's sample rate changed to the value in data.
+
+***************************************************************************/
+
+#pragma once
+
+#ifndef __SRLFILE_H__
+#define __SRLFILE_H__
+
+#include "osdcomm.h"
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+const UINT32 SRL_VERSION            = 1;
+const int SRL_HEADER_SIZE           = 16;
+const int SRL_RECORD_SIZE           = 16;
+
+const UINT32 SRL_PSEUDO_OFFSET      = 0x80000000;
+const UINT32 SRL_RATE_CHANGE        = 0xffffffff;
+
+
+#endif  /* __SRLFILE_H__ */
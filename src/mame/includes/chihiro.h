@@ -190,7 +190,6 @@ public:
 		objectdata = &(object_data_alloc());
 		objectdata->data = this;
 		combiner.used = 0;
-		combiner.lock = osd_lock_alloc();
 		enabled_vertex_attributes = 0;
 		indexesleft_count = 0;
 		vertex_pipeline = 4;
@@ -251,26 +250,26 @@ public:
 	int geforce_exec_method(address_space &space, UINT32 channel, UINT32 subchannel, UINT32 method, UINT32 address, int &countlen);
 	UINT32 texture_get_texel(int number, int x, int y);
 	void write_pixel(int x, int y, UINT32 color, UINT32 depth);
-	void combiner_initialize_registers(UINT32 argb8[6]);
-	void combiner_initialize_stage(int stage_number);
-	void combiner_initialize_final();
-	void combiner_map_input(int stage_number); // map combiner registers to variables A..D
-	void combiner_map_output(int stage_number); // map combiner calculation results to combiner registers
-	void combiner_map_final_input(); // map final combiner registers to variables A..F
-	void combiner_final_output(); // generate final combiner output
-	float combiner_map_input_select(int code, int index); // get component index in register code
-	float *combiner_map_input_select3(int code); // get pointer to register code
-	float *combiner_map_output_select3(int code); // get pointer to register code for output
+	void combiner_initialize_registers(int id, UINT32 argb8[6]);
+	void combiner_initialize_stage(int id, int stage_number);
+	void combiner_initialize_final(int id);
+	void combiner_map_input(int id, int stage_number); // map combiner registers to variables A..D
+	void combiner_map_output(int id, int stage_number); // map combiner calculation results to combiner registers
+	void combiner_map_final_input(int id); // map final combiner registers to variables A..F
+	void combiner_final_output(int id); // generate final combiner output
+	float combiner_map_input_select(int id, int code, int index); // get component index in register code
+	float *combiner_map_input_select3(int id, int code); // get pointer to register code
+	float *combiner_map_output_select3(int id, int code); // get pointer to register code for output
 	float combiner_map_input_function(int code, float value); // apply input mapping function code to value
 	void combiner_map_input_function3(int code, float *data); // apply input mapping function code to data
-	void combiner_function_AB(float result[4]);
-	void combiner_function_AdotB(float result[4]);
-	void combiner_function_CD(float result[4]);
-	void combiner_function_CdotD(float result[4]);
-	void combiner_function_ABmuxCD(float result[4]);
-	void combiner_function_ABsumCD(float result[4]);
-	void combiner_compute_rgb_outputs(int index);
-	void combiner_compute_a_outputs(int index);
+	void combiner_function_AB(int id, float result[4]);
+	void combiner_function_AdotB(int id, float result[4]);
+	void combiner_function_CD(int id, float result[4]);
+	void combiner_function_CdotD(int id, float result[4]);
+	void combiner_function_ABmuxCD(int id, float result[4]);
+	void combiner_function_ABsumCD(int id, float result[4]);
+	void combiner_compute_rgb_outputs(int id, int index);
+	void combiner_compute_a_outputs(int id, int index);
 	void combiner_argb8_float(UINT32 color, float reg[4]);
 	UINT32 combiner_float_argb8(float reg[4]);
 	UINT32 dilate0(UINT32 value, int bits);
@@ -339,34 +338,36 @@ public:
 	int indexesleft_first;
 	UINT32 indexesleft[8];
 	struct {
-		float variable_A[4]; // 0=R 1=G 2=B 3=A
-		float variable_B[4];
-		float variable_C[4];
-		float variable_D[4];
-		float variable_E[4];
-		float variable_F[4];
-		float variable_G;
-		float variable_EF[4];
-		float variable_sumclamp[4];
-		float function_RGBop1[4]; // 0=R 1=G 2=B
-		float function_RGBop2[4];
-		float function_RGBop3[4];
-		float function_Aop1;
-		float function_Aop2;
-		float function_Aop3;
-		float register_primarycolor[4]; // rw
-		float register_secondarycolor[4];
-		float register_texture0color[4];
-		float register_texture1color[4];
-		float register_texture2color[4];
-		float register_texture3color[4];
-		float register_color0[4];
-		float register_color1[4];
-		float register_spare0[4];
-		float register_spare1[4];
-		float register_fogcolor[4]; // ro
-		float register_zero[4];
-		float output[4];
+		struct {
+			float variable_A[4]; // 0=R 1=G 2=B 3=A
+			float variable_B[4];
+			float variable_C[4];
+			float variable_D[4];
+			float variable_E[4];
+			float variable_F[4];
+			float variable_G;
+			float variable_EF[4];
+			float variable_sumclamp[4];
+			float function_RGBop1[4]; // 0=R 1=G 2=B
+			float function_RGBop2[4];
+			float function_RGBop3[4];
+			float function_Aop1;
+			float function_Aop2;
+			float function_Aop3;
+			float register_primarycolor[4]; // rw
+			float register_secondarycolor[4];
+			float register_texture0color[4];
+			float register_texture1color[4];
+			float register_texture2color[4];
+			float register_texture3color[4];
+			float register_color0[4];
+			float register_color1[4];
+			float register_spare0[4];
+			float register_spare1[4];
+			float register_fogcolor[4]; // ro
+			float register_zero[4];
+			float output[4];
+		} work[WORK_MAX_THREADS]; // per-thread working registers, indexed by poly_manager threadid
 		struct {
 			float register_constantcolor0[4];
 			float register_constantcolor1[4];
@@ -439,7 +440,6 @@ public:
 		} final;
 		int stages;
 		int used;
-		osd_lock *lock;
 	} combiner;
 	bool alpha_test_enabled;
 	int alpha_func;
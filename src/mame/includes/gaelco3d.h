@@ -33,7 +33,6 @@ public:
 	gaelco3d_renderer(gaelco3d_state &state);
 
 	bitmap_ind16 &screenbits() { return m_screenbits; }
-	UINT32 polygons() { UINT32 result = m_polygons; m_polygons = 0; return result; }
 
 	void render_poly(screen_device &screen, UINT32 *polydata);
 
@@ -41,7 +40,6 @@ private:
 	gaelco3d_state &m_state;
 	bitmap_ind16 m_screenbits;
 	bitmap_ind16 m_zbuffer;
-	UINT32 m_polygons;
 	offs_t m_texture_size;
 	offs_t m_texmask_size;
 	UINT8 *m_texture;
@@ -102,6 +100,7 @@ public:
 	int m_lastscan;
 	int m_video_changed;
 	gaelco3d_renderer *m_poly;
+	gaelco3d_renderer::fence_t m_render_fence;
 	DECLARE_WRITE16_MEMBER(irq_ack_w);
 	DECLARE_WRITE32_MEMBER(irq_ack32_w);
 	DECLARE_WRITE16_MEMBER(sound_data_w);
@@ -184,8 +184,6 @@ public:
 	m3_triangle* m_tri_alpha_buffer;
 	int m_tri_buffer_ptr;
 	int m_tri_alpha_buffer_ptr;
-	int m_viewport_tri_index[4];
-	int m_viewport_tri_alpha_index[4];
 
 	DECLARE_READ32_MEMBER(rtc72421_r);
 	DECLARE_WRITE32_MEMBER(rtc72421_w);
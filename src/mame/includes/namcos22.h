@@ -157,6 +157,7 @@ private:
 	struct namcos22_scenenode *alloc_scenenode(running_machine &machine, struct namcos22_scenenode *node);
 
 	void renderscanline_uvi_full(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, int threadid);
+	template<bool _Super, int _FogMode> void renderspan_uvi(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, const pen_t *pens, int penmask, int penshift);
 	void renderscanline_sprite(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, int threadid);
 };
 
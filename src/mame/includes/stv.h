@@ -346,6 +346,7 @@ public:
 	void stv_vdp2_get_window1_coordinates(int *s_x, int *e_x, int *s_y, int *e_y);
 	int get_window_pixel(int s_x,int e_x,int s_y,int e_y,int x, int y,UINT8 win_num);
 	int stv_vdp2_apply_window_on_layer(rectangle &cliprect);
+	void stv_vdp2_latch_window_coordinates( void );
 
 	void stv_vdp2_draw_basic_tilemap(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void stv_vdp2_draw_basic_bitmap(bitmap_rgb32 &bitmap, const rectangle &cliprect);
@@ -443,6 +444,12 @@ public:
 		int layer_name; /* just to keep track */
 	} stv2_current_tilemap;
 
+	/* window 0/1 coordinates, latched once per frame for the per-pixel window test */
+	struct
+	{
+		int s_x, e_x, s_y, e_y;
+	} m_vdp2_window[2];
+
 	struct rotation_table
 	{
 		INT32   xst;
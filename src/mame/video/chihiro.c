@@ -1843,7 +1843,6 @@ void nv2a_renderer::render_register_combiners(INT32 scanline, const extent_t &ex
 
 	if ((extent.startx < 0) || (extent.stopx > 640))
 		return;
-	osd_lock_acquire(combiner.lock); // needed since multithreading is not supported yet
 	x = extent.stopx - extent.startx - 1; // number of pixels to draw
 	while (x >= 0) {
 		xp = extent.startx + x;
@@ -1865,30 +1864,29 @@ void nv2a_renderer::render_register_combiners(INT32 scanline, const extent_t &ex
 		}
 		// 2: compute
 		// 2.1: initialize
-		combiner_initialize_registers(color);
+		combiner_initialize_registers(threadid, color);
 		// 2.2: general cmbiner stages
 		for (n = 0; n < combiner.stages; n++) {
 			// 2.2.1 initialize
-			combiner_initialize_stage(n);
+			combiner_initialize_stage(threadid, n);
 			// 2.2.2 map inputs
-			combiner_map_input(n);
+			combiner_map_input(threadid, n);
 			// 2.2.3 compute possible outputs
-			combiner_compute_rgb_outputs(n);
-			combiner_compute_a_outputs(n);
+			combiner_compute_rgb_outputs(threadid, n);
+			combiner_compute_a_outputs(threadid, n);
 			// 2.2.4 map outputs to registers
-			combiner_map_output(n);
+			combiner_map_output(threadid, n);
 		}
 		// 2.3: final cmbiner stage
-		combiner_initialize_final();
-		combiner_map_final_input();
-		combiner_final_output();
-		a8r8g8b8 = combiner_float_argb8(combiner.output);
+		combiner_initialize_final(threadid);
+		combiner_map_final_input(threadid);
+		combiner_final_output(threadid);
+		a8r8g8b8 = combiner_float_argb8(combiner.work[threadid].output);
 		// 3: write pixel
 		z = (extent.param[PARAM_Z].start + (float)x*extent.param[PARAM_Z].dpdx);
 		write_pixel(xp, scanline, a8r8g8b8, z);
 		x--;
 	}
-	osd_lock_release(combiner.lock);
 }
 
 #if 0
@@ -3095,83 +3093,83 @@ UINT32 nv2a_renderer::combiner_float_argb8(float reg[4])
 	return (a << 24) | (r << 16) | (g << 8) | b;
 }
 
-float nv2a_renderer::combiner_map_input_select(int code, int index)
+float nv2a_renderer::combiner_map_input_select(int id, int code, int index)
 {
 	switch (code) {
 	case 0:
 	default:
-		return combiner.register_zero[index];
+		return combiner.work[id].register_zero[index];
 	case 1:
-		return combiner.register_color0[index];
+		return combiner.work[id].register_color0[index];
 	case 2:
-		return combiner.register_color1[index];
+		return combiner.work[id].register_color1[index];
 	case 3:
-		return combiner.register_fogcolor[index];
+		return combiner.work[id].register_fogcolor[index];
 	case 4:
-		return combiner.register_primarycolor[index];
+		return combiner.work[id].register_primarycolor[index];
 	case 5:
-		return combiner.register_secondarycolor[index];
+		return combiner.work[id].register_secondarycolor[index];
 	case 8:
-		return combiner.register_texture0color[index];
+		return combiner.work[id].register_texture0color[index];
 	case 9:
-		return combiner.register_texture1color[index];
+		return combiner.work[id].register_texture1color[index];
 	case 10:
-		return combiner.register_texture2color[index];
+		return combiner.work[id].register_texture2color[index];
 	case 11:
-		return combiner.register_texture3color[index];
+		return combiner.work[id].register_texture3color[index];
 	case 12:
-		return combiner.register_spare0[index];
+		return combiner.work[id].register_spare0[index];
 	case 13:
-		return combiner.register_spare1[index];
+		return combiner.work[id].register_spare1[index];
 	case 14:
-		return combiner.variable_sumclamp[index];
+		return combiner.work[id].variable_sumclamp[index];
 	case 15:
-		return combiner.variable_EF[index];
+		return combiner.work[id].variable_EF[index];
 	}
 
 	// never executed
 	//return 0;
 }
 
-float *nv2a_renderer::combiner_map_input_select3(int code)
+float *nv2a_renderer::combiner_map_input_select3(int id, int code)
 {
 	switch (code) {
 	case 0:
 	default:
-		return combiner.register_zero;
+		return combiner.work[id].register_zero;
 	case 1:
-		return combiner.register_color0;
+		return combiner.work[id].register_color0;
 	case 2:
-		return combiner.register_color1;
+		return combiner.work[id].register_color1;
 	case 3:
-		return combiner.register_fogcolor;
+		return combiner.work[id].register_fogcolor;
 	case 4:
-		return combiner.register_primarycolor;
+		return combiner.work[id].register_primarycolor;
 	case 5:
-		return combiner.register_secondarycolor;
+		return combiner.work[id].register_secondarycolor;
 	case 8:
-		return combiner.register_texture0color;
+		return combiner.work[id].register_texture0color;
 	case 9:
-		return combiner.register_texture1color;
+		return combiner.work[id].register_texture1color;
 	case 10:
-		return combiner.register_texture2color;
+		return combiner.work[id].register_texture2color;
 	case 11:
-		return combiner.register_texture3color;
+		return combiner.work[id].register_texture3color;
 	case 12:
-		return combiner.register_spare0;
+		return combiner.work[id].register_spare0;
 	case 13:
-		return combiner.register_spare1;
+		return combiner.work[id].register_spare1;
 	case 14:
-		return combiner.variable_sumclamp;
+		return combiner.work[id].variable_sumclamp;
 	case 15:
-		return combiner.variable_EF;
+		return combiner.work[id].variable_EF;
 	}
 
 	// never executed
 	//return 0;
 }
 
-float *nv2a_renderer::combiner_map_output_select3(int code)
+float *nv2a_renderer::combiner_map_output_select3(int id, int code)
 {
 	switch (code) {
 	case 0:
@@ -3183,21 +3181,21 @@ float *nv2a_renderer::combiner_map_output_select3(int code)
 	case 3:
 		return 0;
 	case 4:
-		return combiner.register_primarycolor;
+		return combiner.work[id].register_primarycolor;
 	case 5:
-		return combiner.register_secondarycolor;
+		return combiner.work[id].register_secondarycolor;
 	case 8:
-		return combiner.register_texture0color;
+		return combiner.work[id].register_texture0color;
 	case 9:
-		return combiner.register_texture1color;
+		return combiner.work[id].register_texture1color;
 	case 10:
-		return combiner.register_texture2color;
+		return combiner.work[id].register_texture2color;
 	case 11:
-		return combiner.register_texture3color;
+		return combiner.work[id].register_texture3color;
 	case 12:
-		return combiner.register_spare0;
+		return combiner.work[id].register_spare0;
 	case 13:
-		return combiner.register_spare1;
+		return combiner.work[id].register_spare1;
 	case 14:
 		return 0;
 	case 15:
@@ -3284,276 +3282,276 @@ void nv2a_renderer::combiner_map_input_function3(int code, float *data)
 	}
 }
 
-void nv2a_renderer::combiner_initialize_registers(UINT32 argb8[6])
+void nv2a_renderer::combiner_initialize_registers(int id, UINT32 argb8[6])
 {
-	combiner_argb8_float(argb8[0], combiner.register_primarycolor);
-	combiner_argb8_float(argb8[1], combiner.register_secondarycolor);
-	combiner_argb8_float(argb8[2], combiner.register_texture0color);
-	combiner_argb8_float(argb8[3], combiner.register_texture1color);
-	combiner_argb8_float(argb8[4], combiner.register_texture2color);
-	combiner_argb8_float(argb8[5], combiner.register_texture3color);
-	combiner.register_spare0[3] = combiner.register_texture0color[3];
-	combiner.register_zero[0] = combiner.register_zero[1] = combiner.register_zero[2] = combiner.register_zero[3] = 0;
+	combiner_argb8_float(argb8[0], combiner.work[id].register_primarycolor);
+	combiner_argb8_float(argb8[1], combiner.work[id].register_secondarycolor);
+	combiner_argb8_float(argb8[2], combiner.work[id].register_texture0color);
+	combiner_argb8_float(argb8[3], combiner.work[id].register_texture1color);
+	combiner_argb8_float(argb8[4], combiner.work[id].register_texture2color);
+	combiner_argb8_float(argb8[5], combiner.work[id].register_texture3color);
+	combiner.work[id].register_spare0[3] = combiner.work[id].register_texture0color[3];
+	combiner.work[id].register_zero[0] = combiner.work[id].register_zero[1] = combiner.work[id].register_zero[2] = combiner.work[id].register_zero[3] = 0;
 }
 
-void nv2a_renderer::combiner_initialize_stage(int stage_number)
+void nv2a_renderer::combiner_initialize_stage(int id, int stage_number)
 {
 	int n = stage_number;
 
 	// put register_constantcolor0 in register_color0
-	combiner.register_color0[0] = combiner.stage[n].register_constantcolor0[0];
-	combiner.register_color0[1] = combiner.stage[n].register_constantcolor0[1];
-	combiner.register_color0[2] = combiner.stage[n].register_constantcolor0[2];
-	combiner.register_color0[3] = combiner.stage[n].register_constantcolor0[3];
+	combiner.work[id].register_color0[0] = combiner.stage[n].register_constantcolor0[0];
+	combiner.work[id].register_color0[1] = combiner.stage[n].register_constantcolor0[1];
+	combiner.work[id].register_color0[2] = combiner.stage[n].register_constantcolor0[2];
+	combiner.work[id].register_color0[3] = combiner.stage[n].register_constantcolor0[3];
 	// put register_constantcolor1 in register_color1
-	combiner.register_color1[0] = combiner.stage[n].register_constantcolor1[0];
-	combiner.register_color1[1] = combiner.stage[n].register_constantcolor1[1];
-	combiner.register_color1[2] = combiner.stage[n].register_constantcolor1[2];
-	combiner.register_color1[3] = combiner.stage[n].register_constantcolor1[3];
+	combiner.work[id].register_color1[0] = combiner.stage[n].register_constantcolor1[0];
+	combiner.work[id].register_color1[1] = combiner.stage[n].register_constantcolor1[1];
+	combiner.work[id].register_color1[2] = combiner.stage[n].register_constantcolor1[2];
+	combiner.work[id].register_color1[3] = combiner.stage[n].register_constantcolor1[3];
 }
 
-void nv2a_renderer::combiner_initialize_final()
+void nv2a_renderer::combiner_initialize_final(int id)
 {
 	// put register_constantcolor0 in register_color0
-	combiner.register_color0[0] = combiner.final.register_constantcolor0[0];
-	combiner.register_color0[1] = combiner.final.register_constantcolor0[1];
-	combiner.register_color0[2] = combiner.final.register_constantcolor0[2];
-	combiner.register_color0[3] = combiner.final.register_constantcolor0[3];
+	combiner.work[id].register_color0[0] = combiner.final.register_constantcolor0[0];
+	combiner.work[id].register_color0[1] = combiner.final.register_constantcolor0[1];
+	combiner.work[id].register_color0[2] = combiner.final.register_constantcolor0[2];
+	combiner.work[id].register_color0[3] = combiner.final.register_constantcolor0[3];
 	// put register_constantcolor1 in register_color1
-	combiner.register_color1[0] = combiner.final.register_constantcolor1[0];
-	combiner.register_color1[1] = combiner.final.register_constantcolor1[1];
-	combiner.register_color1[2] = combiner.final.register_constantcolor1[2];
-	combiner.register_color1[3] = combiner.final.register_constantcolor1[3];
+	combiner.work[id].register_color1[0] = combiner.final.register_constantcolor1[0];
+	combiner.work[id].register_color1[1] = combiner.final.register_constantcolor1[1];
+	combiner.work[id].register_color1[2] = combiner.final.register_constantcolor1[2];
+	combiner.work[id].register_color1[3] = combiner.final.register_constantcolor1[3];
 }
 
-void nv2a_renderer::combiner_map_input(int stage_number)
+void nv2a_renderer::combiner_map_input(int id, int stage_number)
 {
 	int n = stage_number;
 	int c, d, i;
 	float v, *pv;
 
 	// A
-	v = combiner_map_input_select(combiner.stage[n].mapin_aA_input, 2 + combiner.stage[n].mapin_aA_component);
-	combiner.variable_A[3] = combiner_map_input_function(combiner.stage[n].mapin_aA_mapping, v);
+	v = combiner_map_input_select(id, combiner.stage[n].mapin_aA_input, 2 + combiner.stage[n].mapin_aA_component);
+	combiner.work[id].variable_A[3] = combiner_map_input_function(combiner.stage[n].mapin_aA_mapping, v);
 	// B
-	v = combiner_map_input_select(combiner.stage[n].mapin_aB_input, 2 + combiner.stage[n].mapin_aB_component);
-	combiner.variable_B[3] = combiner_map_input_function(combiner.stage[n].mapin_aB_mapping, v);
+	v = combiner_map_input_select(id, combiner.stage[n].mapin_aB_input, 2 + combiner.stage[n].mapin_aB_component);
+	combiner.work[id].variable_B[3] = combiner_map_input_function(combiner.stage[n].mapin_aB_mapping, v);
 	// C
-	v = combiner_map_input_select(combiner.stage[n].mapin_aC_input, 2 + combiner.stage[n].mapin_aC_component);
-	combiner.variable_C[3] = combiner_map_input_function(combiner.stage[n].mapin_aC_mapping, v);
+	v = combiner_map_input_select(id, combiner.stage[n].mapin_aC_input, 2 + combiner.stage[n].mapin_aC_component);
+	combiner.work[id].variable_C[3] = combiner_map_input_function(combiner.stage[n].mapin_aC_mapping, v);
 	// D
-	v = combiner_map_input_select(combiner.stage[n].mapin_aD_input, 2 + combiner.stage[n].mapin_aD_component);
-	combiner.variable_D[3] = combiner_map_input_function(combiner.stage[n].mapin_aD_mapping, v);
+	v = combiner_map_input_select(id, combiner.stage[n].mapin_aD_input, 2 + combiner.stage[n].mapin_aD_component);
+	combiner.work[id].variable_D[3] = combiner_map_input_function(combiner.stage[n].mapin_aD_mapping, v);
 
 	// A
-	pv = combiner_map_input_select3(combiner.stage[n].mapin_rgbA_input);
+	pv = combiner_map_input_select3(id, combiner.stage[n].mapin_rgbA_input);
 	c = combiner.stage[n].mapin_rgbA_component * 3;
 	i = ~combiner.stage[n].mapin_rgbA_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_A[d] = pv[c];
+		combiner.work[id].variable_A[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.stage[n].mapin_rgbA_mapping, combiner.variable_A);
+	combiner_map_input_function3(combiner.stage[n].mapin_rgbA_mapping, combiner.work[id].variable_A);
 	// B
-	pv = combiner_map_input_select3(combiner.stage[n].mapin_rgbB_input);
+	pv = combiner_map_input_select3(id, combiner.stage[n].mapin_rgbB_input);
 	c = combiner.stage[n].mapin_rgbB_component * 3;
 	i = ~combiner.stage[n].mapin_rgbB_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_B[d] = pv[c];
+		combiner.work[id].variable_B[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.stage[n].mapin_rgbB_mapping, combiner.variable_B);
+	combiner_map_input_function3(combiner.stage[n].mapin_rgbB_mapping, combiner.work[id].variable_B);
 	// C
-	pv = combiner_map_input_select3(combiner.stage[n].mapin_rgbC_input);
+	pv = combiner_map_input_select3(id, combiner.stage[n].mapin_rgbC_input);
 	c = combiner.stage[n].mapin_rgbC_component * 3;
 	i = ~combiner.stage[n].mapin_rgbC_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_C[d] = pv[c];
+		combiner.work[id].variable_C[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.stage[n].mapin_rgbC_mapping, combiner.variable_C);
+	combiner_map_input_function3(combiner.stage[n].mapin_rgbC_mapping, combiner.work[id].variable_C);
 	// D
-	pv = combiner_map_input_select3(combiner.stage[n].mapin_rgbD_input);
+	pv = combiner_map_input_select3(id, combiner.stage[n].mapin_rgbD_input);
 	c = combiner.stage[n].mapin_rgbD_component * 3;
 	i = ~combiner.stage[n].mapin_rgbD_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_D[d] = pv[c];
+		combiner.work[id].variable_D[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.stage[n].mapin_rgbD_mapping, combiner.variable_D);
+	combiner_map_input_function3(combiner.stage[n].mapin_rgbD_mapping, combiner.work[id].variable_D);
 }
 
-void nv2a_renderer::combiner_map_output(int stage_number)
+void nv2a_renderer::combiner_map_output(int id, int stage_number)
 {
 	int n = stage_number;
 	float *f;
 
 	// rgb
-	f = combiner_map_output_select3(combiner.stage[n].mapout_rgbAB_output);
+	f = combiner_map_output_select3(id, combiner.stage[n].mapout_rgbAB_output);
 	if (f) {
-		f[0] = combiner.function_RGBop1[0];
-		f[1] = combiner.function_RGBop1[1];
-		f[2] = combiner.function_RGBop1[2];
+		f[0] = combiner.work[id].function_RGBop1[0];
+		f[1] = combiner.work[id].function_RGBop1[1];
+		f[2] = combiner.work[id].function_RGBop1[2];
 	}
-	f = combiner_map_output_select3(combiner.stage[n].mapout_rgbCD_output);
+	f = combiner_map_output_select3(id, combiner.stage[n].mapout_rgbCD_output);
 	if (f) {
-		f[0] = combiner.function_RGBop2[0];
-		f[1] = combiner.function_RGBop2[1];
-		f[2] = combiner.function_RGBop2[2];
+		f[0] = combiner.work[id].function_RGBop2[0];
+		f[1] = combiner.work[id].function_RGBop2[1];
+		f[2] = combiner.work[id].function_RGBop2[2];
 	}
 	if ((combiner.stage[n].mapout_rgbAB_dotproduct | combiner.stage[n].mapout_rgbCD_dotproduct) == 0) {
-		f = combiner_map_output_select3(combiner.stage[n].mapout_rgbSUM_output);
+		f = combiner_map_output_select3(id, combiner.stage[n].mapout_rgbSUM_output);
 		if (f) {
-			f[0] = combiner.function_RGBop3[0];
-			f[1] = combiner.function_RGBop3[1];
-			f[2] = combiner.function_RGBop3[2];
+			f[0] = combiner.work[id].function_RGBop3[0];
+			f[1] = combiner.work[id].function_RGBop3[1];
+			f[2] = combiner.work[id].function_RGBop3[2];
 		}
 	}
 	// a
-	f = combiner_map_output_select3(combiner.stage[n].mapout_aAB_output);
+	f = combiner_map_output_select3(id, combiner.stage[n].mapout_aAB_output);
 	if (f)
-		f[3] = combiner.function_Aop1;
-	f = combiner_map_output_select3(combiner.stage[n].mapout_aCD_output);
+		f[3] = combiner.work[id].function_Aop1;
+	f = combiner_map_output_select3(id, combiner.stage[n].mapout_aCD_output);
 	if (f)
-		f[3] = combiner.function_Aop2;
-	f = combiner_map_output_select3(combiner.stage[n].mapout_aSUM_output);
+		f[3] = combiner.work[id].function_Aop2;
+	f = combiner_map_output_select3(id, combiner.stage[n].mapout_aSUM_output);
 	if (f)
-		f[3] = combiner.function_Aop3;
+		f[3] = combiner.work[id].function_Aop3;
 }
 
-void nv2a_renderer::combiner_map_final_input()
+void nv2a_renderer::combiner_map_final_input(int id)
 {
 	int i, c, d;
 	float *pv;
 
 	// E
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbE_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbE_input);
 	c = combiner.final.mapin_rgbE_component * 3;
 	i = ~combiner.final.mapin_rgbE_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_E[d] = pv[c];
+		combiner.work[id].variable_E[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbE_mapping, combiner.variable_E);
+	combiner_map_input_function3(combiner.final.mapin_rgbE_mapping, combiner.work[id].variable_E);
 	// F
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbF_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbF_input);
 	c = combiner.final.mapin_rgbF_component * 3;
 	i = ~combiner.final.mapin_rgbF_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_F[d] = pv[c];
+		combiner.work[id].variable_F[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbF_mapping, combiner.variable_F);
+	combiner_map_input_function3(combiner.final.mapin_rgbF_mapping, combiner.work[id].variable_F);
 	// EF
-	combiner.variable_EF[0] = combiner.variable_E[0] * combiner.variable_F[0];
-	combiner.variable_EF[1] = combiner.variable_E[1] * combiner.variable_F[1];
-	combiner.variable_EF[2] = combiner.variable_E[2] * combiner.variable_F[2];
+	combiner.work[id].variable_EF[0] = combiner.work[id].variable_E[0] * combiner.work[id].variable_F[0];
+	combiner.work[id].variable_EF[1] = combiner.work[id].variable_E[1] * combiner.work[id].variable_F[1];
+	combiner.work[id].variable_EF[2] = combiner.work[id].variable_E[2] * combiner.work[id].variable_F[2];
 	// sumclamp
-	combiner.variable_sumclamp[0] = MAX(0, combiner.register_spare0[0]) + MAX(0, combiner.register_secondarycolor[0]);
-	combiner.variable_sumclamp[1] = MAX(0, combiner.register_spare0[1]) + MAX(0, combiner.register_secondarycolor[1]);
-	combiner.variable_sumclamp[2] = MAX(0, combiner.register_spare0[2]) + MAX(0, combiner.register_secondarycolor[2]);
+	combiner.work[id].variable_sumclamp[0] = MAX(0, combiner.work[id].register_spare0[0]) + MAX(0, combiner.work[id].register_secondarycolor[0]);
+	combiner.work[id].variable_sumclamp[1] = MAX(0, combiner.work[id].register_spare0[1]) + MAX(0, combiner.work[id].register_secondarycolor[1]);
+	combiner.work[id].variable_sumclamp[2] = MAX(0, combiner.work[id].register_spare0[2]) + MAX(0, combiner.work[id].register_secondarycolor[2]);
 	if (combiner.final.color_sum_clamp != 0) {
-		combiner.variable_sumclamp[0] = MIN(combiner.variable_sumclamp[0], 1.0f);
-		combiner.variable_sumclamp[1] = MIN(combiner.variable_sumclamp[1], 1.0f);
-		combiner.variable_sumclamp[2] = MIN(combiner.variable_sumclamp[2], 1.0f);
+		combiner.work[id].variable_sumclamp[0] = MIN(combiner.work[id].variable_sumclamp[0], 1.0f);
+		combiner.work[id].variable_sumclamp[1] = MIN(combiner.work[id].variable_sumclamp[1], 1.0f);
+		combiner.work[id].variable_sumclamp[2] = MIN(combiner.work[id].variable_sumclamp[2], 1.0f);
 	}
 	// A
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbA_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbA_input);
 	c = combiner.final.mapin_rgbA_component * 3;
 	i = ~combiner.final.mapin_rgbA_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_A[d] = pv[c];
+		combiner.work[id].variable_A[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbA_mapping, combiner.variable_A);
+	combiner_map_input_function3(combiner.final.mapin_rgbA_mapping, combiner.work[id].variable_A);
 	// B
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbB_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbB_input);
 	c = combiner.final.mapin_rgbB_component * 3;
 	i = ~combiner.final.mapin_rgbB_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_B[d] = pv[c];
+		combiner.work[id].variable_B[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbB_mapping, combiner.variable_B);
+	combiner_map_input_function3(combiner.final.mapin_rgbB_mapping, combiner.work[id].variable_B);
 	// C
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbC_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbC_input);
 	c = combiner.final.mapin_rgbC_component * 3;
 	i = ~combiner.final.mapin_rgbC_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_C[d] = pv[c];
+		combiner.work[id].variable_C[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbC_mapping, combiner.variable_C);
+	combiner_map_input_function3(combiner.final.mapin_rgbC_mapping, combiner.work[id].variable_C);
 	// D
-	pv = combiner_map_input_select3(combiner.final.mapin_rgbD_input);
+	pv = combiner_map_input_select3(id, combiner.final.mapin_rgbD_input);
 	c = combiner.final.mapin_rgbD_component * 3;
 	i = ~combiner.final.mapin_rgbD_component & 1;
 	for (d = 0; d < 3; d++) {
-		combiner.variable_D[d] = pv[c];
+		combiner.work[id].variable_D[d] = pv[c];
 		c = c + i;
 	}
-	combiner_map_input_function3(combiner.final.mapin_rgbD_mapping, combiner.variable_D);
+	combiner_map_input_function3(combiner.final.mapin_rgbD_mapping, combiner.work[id].variable_D);
 	// G
-	combiner.variable_G = combiner_map_input_select(combiner.final.mapin_aG_input, 2 + combiner.final.mapin_aG_component);
+	combiner.work[id].variable_G = combiner_map_input_select(id, combiner.final.mapin_aG_input, 2 + combiner.final.mapin_aG_component);
 }
 
-void nv2a_renderer::combiner_final_output()
+void nv2a_renderer::combiner_final_output(int id)
 {
 	// rgb
-	combiner.output[0] = combiner.variable_A[0] * combiner.variable_B[0] + (1.0f - combiner.variable_A[0])*combiner.variable_C[0] + combiner.variable_D[0];
-	combiner.output[1] = combiner.variable_A[1] * combiner.variable_B[1] + (1.0f - combiner.variable_A[1])*combiner.variable_C[1] + combiner.variable_D[1];
-	combiner.output[2] = combiner.variable_A[2] * combiner.variable_B[2] + (1.0f - combiner.variable_A[2])*combiner.variable_C[2] + combiner.variable_D[2];
-	combiner.output[0] = MIN(combiner.output[0], 1.0f);
-	combiner.output[1] = MIN(combiner.output[1], 1.0f);
-	combiner.output[2] = MIN(combiner.output[2], 1.0f);
+	combiner.work[id].output[0] = combiner.work[id].variable_A[0] * combiner.work[id].variable_B[0] + (1.0f - combiner.work[id].variable_A[0])*combiner.work[id].variable_C[0] + combiner.work[id].variable_D[0];
+	combiner.work[id].output[1] = combiner.work[id].variable_A[1] * combiner.work[id].variable_B[1] + (1.0f - combiner.work[id].variable_A[1])*combiner.work[id].variable_C[1] + combiner.work[id].variable_D[1];
+	combiner.work[id].output[2] = combiner.work[id].variable_A[2] * combiner.work[id].variable_B[2] + (1.0f - combiner.work[id].variable_A[2])*combiner.work[id].variable_C[2] + combiner.work[id].variable_D[2];
+	combiner.work[id].output[0] = MIN(combiner.work[id].output[0], 1.0f);
+	combiner.work[id].output[1] = MIN(combiner.work[id].output[1], 1.0f);
+	combiner.work[id].output[2] = MIN(combiner.work[id].output[2], 1.0f);
 	// a
-	combiner.output[3] = combiner_map_input_function(combiner.final.mapin_aG_mapping, combiner.variable_G);
+	combiner.work[id].output[3] = combiner_map_input_function(combiner.final.mapin_aG_mapping, combiner.work[id].variable_G);
 }
 
-void nv2a_renderer::combiner_function_AB(float result[4])
+void nv2a_renderer::combiner_function_AB(int id, float result[4])
 {
-	result[0] = combiner.variable_A[0] * combiner.variable_B[0];
-	result[1] = combiner.variable_A[1] * combiner.variable_B[1];
-	result[2] = combiner.variable_A[2] * combiner.variable_B[2];
+	result[0] = combiner.work[id].variable_A[0] * combiner.work[id].variable_B[0];
+	result[1] = combiner.work[id].variable_A[1] * combiner.work[id].variable_B[1];
+	result[2] = combiner.work[id].variable_A[2] * combiner.work[id].variable_B[2];
 }
 
-void nv2a_renderer::combiner_function_AdotB(float result[4])
+void nv2a_renderer::combiner_function_AdotB(int id, float result[4])
 {
-	result[0] = combiner.variable_A[0] * combiner.variable_B[0] + combiner.variable_A[1] * combiner.variable_B[1] + combiner.variable_A[2] * combiner.variable_B[2];
+	result[0] = combiner.work[id].variable_A[0] * combiner.work[id].variable_B[0] + combiner.work[id].variable_A[1] * combiner.work[id].variable_B[1] + combiner.work[id].variable_A[2] * combiner.work[id].variable_B[2];
 	result[1] = result[0];
 	result[2] = result[0];
 }
 
-void nv2a_renderer::combiner_function_CD(float result[4])
+void nv2a_renderer::combiner_function_CD(int id, float result[4])
 {
-	result[0] = combiner.variable_C[0] * combiner.variable_D[0];
-	result[1] = combiner.variable_C[1] * combiner.variable_D[1];
-	result[2] = combiner.variable_C[2] * combiner.variable_D[2];
+	result[0] = combiner.work[id].variable_C[0] * combiner.work[id].variable_D[0];
+	result[1] = combiner.work[id].variable_C[1] * combiner.work[id].variable_D[1];
+	result[2] = combiner.work[id].variable_C[2] * combiner.work[id].variable_D[2];
 }
 
-void nv2a_renderer::combiner_function_CdotD(float result[4])
+void nv2a_renderer::combiner_function_CdotD(int id, float result[4])
 {
-	result[0] = combiner.variable_C[0] * combiner.variable_D[0] + combiner.variable_C[1] * combiner.variable_D[1] + combiner.variable_C[2] * combiner.variable_D[2];
+	result[0] = combiner.work[id].variable_C[0] * combiner.work[id].variable_D[0] + combiner.work[id].variable_C[1] * combiner.work[id].variable_D[1] + combiner.work[id].variable_C[2] * combiner.work[id].variable_D[2];
 	result[1] = result[0];
 	result[2] = result[0];
 }
 
-void nv2a_renderer::combiner_function_ABmuxCD(float result[4])
+void nv2a_renderer::combiner_function_ABmuxCD(int id, float result[4])
 {
-	if (combiner.register_spare0[3] >= 0.5f)
-		combiner_function_AB(result);
+	if (combiner.work[id].register_spare0[3] >= 0.5f)
+		combiner_function_AB(id, result);
 	else
-		combiner_function_CD(result);
+		combiner_function_CD(id, result);
 }
 
-void nv2a_renderer::combiner_function_ABsumCD(float result[4])
+void nv2a_renderer::combiner_function_ABsumCD(int id, float result[4])
 {
-	result[0] = combiner.variable_A[0] * combiner.variable_B[0] + combiner.variable_C[0] * combiner.variable_D[0];
-	result[1] = combiner.variable_A[1] * combiner.variable_B[1] + combiner.variable_C[1] * combiner.variable_D[1];
-	result[2] = combiner.variable_A[2] * combiner.variable_B[2] + combiner.variable_C[2] * combiner.variable_D[2];
+	result[0] = combiner.work[id].variable_A[0] * combiner.work[id].variable_B[0] + combiner.work[id].variable_C[0] * combiner.work[id].variable_D[0];
+	result[1] = combiner.work[id].variable_A[1] * combiner.work[id].variable_B[1] + combiner.work[id].variable_C[1] * combiner.work[id].variable_D[1];
+	result[2] = combiner.work[id].variable_A[2] * combiner.work[id].variable_B[2] + combiner.work[id].variable_C[2] * combiner.work[id].variable_D[2];
 }
 
-void nv2a_renderer::combiner_compute_rgb_outputs(int stage_number)
+void nv2a_renderer::combiner_compute_rgb_outputs(int id, int stage_number)
 {
 	int n = stage_number;
 	int m;
@@ -3580,36 +3578,36 @@ void nv2a_renderer::combiner_compute_rgb_outputs(int stage_number)
 	}
 	if (combiner.stage[n].mapout_rgbAB_dotproduct) {
 		m = 1;
-		combiner_function_AdotB(combiner.function_RGBop1);
+		combiner_function_AdotB(id, combiner.work[id].function_RGBop1);
 	}
 	else {
 		m = 0;
-		combiner_function_AB(combiner.function_RGBop1);
+		combiner_function_AB(id, combiner.work[id].function_RGBop1);
 	}
-	combiner.function_RGBop1[0] = MAX(MIN((combiner.function_RGBop1[0] + biasrgb) * scalergb, 1.0f), -1.0f);
-	combiner.function_RGBop1[1] = MAX(MIN((combiner.function_RGBop1[1] + biasrgb) * scalergb, 1.0f), -1.0f);
-	combiner.function_RGBop1[2] = MAX(MIN((combiner.function_RGBop1[2] + biasrgb) * scalergb, 1.0f), -1.0f);
+	combiner.work[id].function_RGBop1[0] = MAX(MIN((combiner.work[id].function_RGBop1[0] + biasrgb) * scalergb, 1.0f), -1.0f);
+	combiner.work[id].function_RGBop1[1] = MAX(MIN((combiner.work[id].function_RGBop1[1] + biasrgb) * scalergb, 1.0f), -1.0f);
+	combiner.work[id].function_RGBop1[2] = MAX(MIN((combiner.work[id].function_RGBop1[2] + biasrgb) * scalergb, 1.0f), -1.0f);
 	if (combiner.stage[n].mapout_rgbCD_dotproduct) {
 		m = m | 1;
-		combiner_function_CdotD(combiner.function_RGBop2);
+		combiner_function_CdotD(id, combiner.work[id].function_RGBop2);
 	}
 	else
-		combiner_function_CD(combiner.function_RGBop2);
-	combiner.function_RGBop2[0] = MAX(MIN((combiner.function_RGBop2[0] + biasrgb) * scalergb, 1.0f), -1.0f);
-	combiner.function_RGBop2[1] = MAX(MIN((combiner.function_RGBop2[1] + biasrgb) * scalergb, 1.0f), -1.0f);
-	combiner.function_RGBop2[2] = MAX(MIN((combiner.function_RGBop2[2] + biasrgb) * scalergb, 1.0f), -1.0f);
+		combiner_function_CD(id, combiner.work[id].function_RGBop2);
+	combiner.work[id].function_RGBop2[0] = MAX(MIN((combiner.work[id].function_RGBop2[0] + biasrgb) * scalergb, 1.0f), -1.0f);
+	combiner.work[id].function_RGBop2[1] = MAX(MIN((combiner.work[id].function_RGBop2[1] + biasrgb) * scalergb, 1.0f), -1.0f);
+	combiner.work[id].function_RGBop2[2] = MAX(MIN((combiner.work[id].function_RGBop2[2] + biasrgb) * scalergb, 1.0f), -1.0f);
 	if (m == 0) {
 		if (combiner.stage[n].mapout_rgb_muxsum)
-			combiner_function_ABmuxCD(combiner.function_RGBop3);
+			combiner_function_ABmuxCD(id, combiner.work[id].function_RGBop3);
 		else
-			combiner_function_ABsumCD(combiner.function_RGBop3);
-		combiner.function_RGBop3[0] = MAX(MIN((combiner.function_RGBop3[0] + biasrgb) * scalergb, 1.0f), -1.0f);
-		combiner.function_RGBop3[1] = MAX(MIN((combiner.function_RGBop3[1] + biasrgb) * scalergb, 1.0f), -1.0f);
-		combiner.function_RGBop3[2] = MAX(MIN((combiner.function_RGBop3[2] + biasrgb) * scalergb, 1.0f), -1.0f);
+			combiner_function_ABsumCD(id, combiner.work[id].function_RGBop3);
+		combiner.work[id].function_RGBop3[0] = MAX(MIN((combiner.work[id].function_RGBop3[0] + biasrgb) * scalergb, 1.0f), -1.0f);
+		combiner.work[id].function_RGBop3[1] = MAX(MIN((combiner.work[id].function_RGBop3[1] + biasrgb) * scalergb, 1.0f), -1.0f);
+		combiner.work[id].function_RGBop3[2] = MAX(MIN((combiner.work[id].function_RGBop3[2] + biasrgb) * scalergb, 1.0f), -1.0f);
 	}
 }
 
-void nv2a_renderer::combiner_compute_a_outputs(int stage_number)
+void nv2a_renderer::combiner_compute_a_outputs(int id, int stage_number)
 {
 	int n = stage_number;
 	float biasa, scalea;
@@ -3633,19 +3631,19 @@ void nv2a_renderer::combiner_compute_a_outputs(int stage_number)
 		scalea = 0.5;
 		break;
 	}
-	combiner.function_Aop1 = combiner.variable_A[3] * combiner.variable_B[3];
-	combiner.function_Aop1 = MAX(MIN((combiner.function_Aop1 + biasa) * scalea, 1.0f), -1.0f);
-	combiner.function_Aop2 = combiner.variable_C[3] * combiner.variable_D[3];
-	combiner.function_Aop2 = MAX(MIN((combiner.function_Aop2 + biasa) * scalea, 1.0f), -1.0f);
+	combiner.work[id].function_Aop1 = combiner.work[id].variable_A[3] * combiner.work[id].variable_B[3];
+	combiner.work[id].function_Aop1 = MAX(MIN((combiner.work[id].function_Aop1 + biasa) * scalea, 1.0f), -1.0f);
+	combiner.work[id].function_Aop2 = combiner.work[id].variable_C[3] * combiner.work[id].variable_D[3];
+	combiner.work[id].function_Aop2 = MAX(MIN((combiner.work[id].function_Aop2 + biasa) * scalea, 1.0f), -1.0f);
 	if (combiner.stage[n].mapout_a_muxsum) {
-		if (combiner.register_spare0[3] >= 0.5f)
-			combiner.function_Aop3 = combiner.variable_A[3] * combiner.variable_B[3];
+		if (combiner.work[id].register_spare0[3] >= 0.5f)
+			combiner.work[id].function_Aop3 = combiner.work[id].variable_A[3] * combiner.work[id].variable_B[3];
 		else
-			combiner.function_Aop3 = combiner.variable_C[3] * combiner.variable_D[3];
+			combiner.work[id].function_Aop3 = combiner.work[id].variable_C[3] * combiner.work[id].variable_D[3];
 	}
 	else
-		combiner.function_Aop3 = combiner.variable_A[3] * combiner.variable_B[3] + combiner.variable_C[3] * combiner.variable_D[3];
-	combiner.function_Aop3 = MAX(MIN((combiner.function_Aop3 + biasa) * scalea, 1.0f), -1.0f);
+		combiner.work[id].function_Aop3 = combiner.work[id].variable_A[3] * combiner.work[id].variable_B[3] + combiner.work[id].variable_C[3] * combiner.work[id].variable_D[3];
+	combiner.work[id].function_Aop3 = MAX(MIN((combiner.work[id].function_Aop3 + biasa) * scalea, 1.0f), -1.0f);
 }
 
 bool nv2a_renderer::vblank_callback(screen_device &screen, bool state)
@@ -26,11 +26,10 @@
 
 
 gaelco3d_renderer::gaelco3d_renderer(gaelco3d_state &state)
-	: poly_manager<float, gaelco3d_object_data, 1, 2000>(state.machine()),
+	: poly_manager<float, gaelco3d_object_data, 1, 2000>(state.machine(), DISPLAY_STATS ? POLYFLAG_TIME_WAITS : 0),
 		m_state(state),
 		m_screenbits(state.m_screen->width(), state.m_screen->height()),
 		m_zbuffer(state.m_screen->width(), state.m_screen->height()),
-		m_polygons(0),
 		m_texture_size(state.memregion("gfx1")->bytes()),
 		m_texmask_size(state.memregion("gfx2")->bytes() * 8),
 		m_texture(auto_alloc_array(state.machine(), UINT8, m_texture_size)),
@@ -69,6 +68,7 @@ gaelco3d_renderer::gaelco3d_renderer(gaelco3d_state &state)
 void gaelco3d_state::video_start()
 {
 	m_poly = auto_alloc(machine(), gaelco3d_renderer(*this));
+	m_render_fence = m_poly->fence();
 
 	m_palette = auto_alloc_array(machine(), rgb_t, 32768);
 	m_polydata_buffer = auto_alloc_array(machine(), UINT32, MAX_POLYDATA);
@@ -194,8 +194,6 @@ void gaelco3d_renderer::render_poly(screen_device &screen, UINT32 *polydata)
 		/* color 0x7f seems to be hard-coded as a 50% alpha blend */
 		else
 			render_triangle_fan(visarea, render_delegate(FUNC(gaelco3d_renderer::render_alphablend), this), 0, vertnum, &vert[0]);
-
-		m_polygons += vertnum - 2;
 	}
 }
 
@@ -348,13 +346,18 @@ void gaelco3d_renderer::render_alphablend(INT32 scanline, const extent_t &extent
 
 void gaelco3d_state::gaelco3d_render(screen_device &screen)
 {
-	/* wait for any queued stuff to complete */
-	m_poly->wait("Time to render");
+	/* mark the end of the frame; the screen update waits for it only if the */
+	/* rasterizer hasn't caught up by then, so the CPUs keep running meanwhile */
+	m_render_fence = m_poly->fence();
 
 #if DISPLAY_STATS
 {
 	int scan = screen.vpos();
-	popmessage("Polys = %4d  Timeleft = %3d", m_poly->polygons(), (m_lastscan < scan) ? (scan - m_lastscan) : (scan + (m_lastscan - screen.visible_area().max_y)));
+	const gaelco3d_renderer::frame_stats &stats = m_poly->stats();
+	popmessage("Polys = %4d  Pixels = %7d  Wait = %3dus  Timeleft = %3d", stats.polygons, (UINT32)stats.pixels,
+			(int)(stats.wait_ticks * 1000000 / osd_ticks_per_second()),
+			(m_lastscan < scan) ? (scan - m_lastscan) : (scan + (m_lastscan - screen.visible_area().max_y)));
+	m_poly->reset_stats();
 }
 #endif
 
@@ -468,6 +471,8 @@ UINT32 gaelco3d_state::screen_update_gaelco3d(screen_device &screen, bitmap_ind1
     }
     else*/
 	{
+		if (m_video_changed && !m_poly->fence_reached(m_render_fence))
+			m_poly->wait("Time to render");
 		if (m_video_changed)
 			copybitmap(bitmap, m_poly->screenbits(), 0,1, 0,0, cliprect);
 		ret = m_video_changed;
@@ -89,10 +89,10 @@
 *********************************************************************************************************************************/
 #include "emu.h"
 #include "video/segaic24.h"
-#include "video/polylgcy.h"
 #include "includes/model2.h"
 
 #define MODEL2_VIDEO_DEBUG 0
+#define DISPLAY_STATS       0
 
 
 #define pz      p[0]
@@ -139,20 +139,6 @@ struct quad_m2
 	UINT8               luma;
 };
 
-struct m2_poly_extra_data
-{
-	model2_state *  state;
-	UINT32      lumabase;
-	UINT32      colorbase;
-	UINT32 *    texsheet;
-	UINT32      texwidth;
-	UINT32      texheight;
-	UINT32      texx, texy;
-	UINT8       texmirrorx;
-	UINT8       texmirrory;
-};
-
-
 /*******************************************
  *
  *  Generic 3D Math Functions
@@ -912,22 +898,24 @@ INLINE UINT16 get_texel( UINT32 base_x, UINT32 base_y, int x, int y, UINT32 *she
 
 /***********************************************************************************************/
 
-static const poly_draw_scanline_func render_funcs[8] =
+model2_renderer::model2_renderer(model2_state &state)
+	: poly_manager<float, m2_poly_extra_data, 3, 4000>(state.machine(), DISPLAY_STATS ? POLYFLAG_TIME_WAITS : 0),
+		m_state(state)
 {
-	model2_3d_render_0, /* checker = 0, textured = 0, translucent = 0 */
-	model2_3d_render_1, /* checker = 0, textured = 0, translucent = 1 */
-	model2_3d_render_2, /* checker = 0, textured = 1, translucent = 0 */
-	model2_3d_render_3, /* checker = 0, textured = 1, translucent = 1 */
-	model2_3d_render_4, /* checker = 1, textured = 0, translucent = 0 */
-	model2_3d_render_5, /* checker = 1, textured = 0, translucent = 1 */
-	model2_3d_render_6, /* checker = 1, textured = 1, translucent = 0 */
-	model2_3d_render_7  /* checker = 1, textured = 1, translucent = 1 */
-};
+	m_renderfuncs[0] = render_delegate(FUNC(model2_renderer::model2_3d_render_0), this); /* checker = 0, textured = 0, translucent = 0 */
+	m_renderfuncs[1] = render_delegate(FUNC(model2_renderer::model2_3d_render_1), this); /* checker = 0, textured = 0, translucent = 1 */
+	m_renderfuncs[2] = render_delegate(FUNC(model2_renderer::model2_3d_render_2), this); /* checker = 0, textured = 1, translucent = 0 */
+	m_renderfuncs[3] = render_delegate(FUNC(model2_renderer::model2_3d_render_3), this); /* checker = 0, textured = 1, translucent = 1 */
+	m_renderfuncs[4] = render_delegate(FUNC(model2_renderer::model2_3d_render_4), this); /* checker = 1, textured = 0, translucent = 0 */
+	m_renderfuncs[5] = render_delegate(FUNC(model2_renderer::model2_3d_render_5), this); /* checker = 1, textured = 0, translucent = 1 */
+	m_renderfuncs[6] = render_delegate(FUNC(model2_renderer::model2_3d_render_6), this); /* checker = 1, textured = 1, translucent = 0 */
+	m_renderfuncs[7] = render_delegate(FUNC(model2_renderer::model2_3d_render_7), this); /* checker = 1, textured = 1, translucent = 1 */
+}
 
 static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangle *tri, const rectangle &cliprect )
 {
-	legacy_poly_manager *poly = state->m_poly;
-	m2_poly_extra_data *extra = (m2_poly_extra_data *)poly_get_extra_data(poly);
+	model2_renderer *poly = state->m_poly;
+	m2_poly_extra_data *extra = &poly->object_data_alloc();
 	UINT8       renderer;
 
 	/* select renderer based on attributes (bit15 = checker, bit14 = textured, bit13 = transparent */
@@ -937,7 +925,7 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 	rectangle vp(tri->viewport[0] - 8, tri->viewport[2] - 8, (384-tri->viewport[3])+90, (384-tri->viewport[1])+90);
 	vp &= cliprect;
 
-	extra->state = state;
+	extra->destmap = &bitmap;
 	extra->lumabase = ((tri->texheader[1] & 0xFF) << 7) + ((tri->luma >> 5) ^ 0x7);
 	extra->colorbase = (tri->texheader[3] >> 6) & 0x3FF;
 
@@ -962,10 +950,10 @@ static void model2_3d_render( model2_state *state, bitmap_rgb32 &bitmap, triangl
 		tri->v[2].pu = tri->v[2].pu * tri->v[2].pz * (1.0f / 8.0f);
 		tri->v[2].pv = tri->v[2].pv * tri->v[2].pz * (1.0f / 8.0f);
 
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 3, &tri->v[0], &tri->v[1], &tri->v[2]);
+		poly->render_triangle(vp, poly->render_func(renderer), 3, tri->v[0], tri->v[1], tri->v[2]);
 	}
 	else
-		poly_render_triangle(poly, &bitmap, vp, render_funcs[renderer], 0, &tri->v[0], &tri->v[1], &tri->v[2]);
+		poly->render_triangle(vp, poly->render_func(renderer), 0, tri->v[0], tri->v[1], tri->v[2]);
 }
 
 /*
@@ -1083,7 +1071,16 @@ void model2_state::model2_3d_frame_end( bitmap_rgb32 &bitmap, const rectangle &c
 			}
 		}
 	}
-	poly_wait(m_poly, "End of frame");
+	m_poly->wait("End of frame");
+
+#if DISPLAY_STATS
+{
+	const model2_renderer::frame_stats &stats = m_poly->stats();
+	popmessage("Polys = %4d  Units = %5d  Pixels = %7d  Wait = %3dus", stats.polygons, stats.units, (UINT32)stats.pixels,
+			(int)(stats.wait_ticks * 1000000 / osd_ticks_per_second()));
+	m_poly->reset_stats();
+}
+#endif
 }
 
 /* 3D Rasterizer main data input port */
@@ -2694,11 +2691,6 @@ static void geo_parse( model2_state *state )
 /***********************************************************************************************/
 
 
-void model2_state::model2_exit()
-{
-	poly_free(m_poly);
-}
-
 VIDEO_START_MEMBER(model2_state,model2)
 {
 	const rectangle &visarea = m_screen->visible_area();
@@ -2707,8 +2699,7 @@ VIDEO_START_MEMBER(model2_state,model2)
 
 	m_sys24_bitmap.allocate(width, height+4);
 
-	m_poly = poly_alloc(machine(), 4000, sizeof(m2_poly_extra_data), 0);
-	machine().add_notifier(MACHINE_NOTIFY_EXIT, machine_notify_delegate(FUNC(model2_state::model2_exit), this));
+	m_poly = auto_alloc(machine(), model2_renderer(*this));
 
 	/* initialize the hardware rasterizer */
 	model2_3d_init( machine(), (UINT16*)memregion("user3")->base() );
@@ -1192,31 +1192,6 @@ void model3_state::real3d_display_list_end()
 
 	reset_triangle_buffers();
 	real3d_traverse_display_list();
-
-	for (int i=0; i < 4; i++)
-	{
-		int ticount, tiacount;
-		int ti = m_viewport_tri_index[i];
-		int tia = m_viewport_tri_alpha_index[i];
-		if (i < 3)
-		{
-			ticount = m_viewport_tri_index[i+1] - ti;
-			tiacount = m_viewport_tri_alpha_index[i+1] - tia;
-		}
-		else
-		{
-			ticount = m_tri_buffer_ptr - ti;
-			tiacount = m_tri_alpha_buffer_ptr - tia;
-		}
-
-		if (ticount > 0 || tiacount > 0)
-		{
-			m_renderer->clear_zb();
-			m_renderer->draw_opaque_triangles(&m_tri_buffer[ti], ticount);
-			m_renderer->draw_alpha_triangles(&m_tri_alpha_buffer[tia], tiacount);
-			m_renderer->wait_for_polys();
-		}
-	}
 }
 
 void model3_state::real3d_display_list1_dma(UINT32 src, UINT32 dst, int length, int byteswap)
@@ -2082,10 +2057,27 @@ void model3_state::real3d_traverse_display_list()
 
 	for (int pri = 0; pri < 4; pri++)
 	{
-		m_viewport_tri_index[pri] = m_tri_buffer_ptr;
-		m_viewport_tri_alpha_index[pri] = m_tri_alpha_buffer_ptr;
+		int ti = m_tri_buffer_ptr;
+		int tia = m_tri_alpha_buffer_ptr;
+
 		draw_viewport(pri, 0x800000);
+
+		int ticount = m_tri_buffer_ptr - ti;
+		int tiacount = m_tri_alpha_buffer_ptr - tia;
+
+		// hand this viewport to the renderer now, so its polygons are
+		// rasterized while the next viewport's nodes are being traversed
+		if (ticount > 0 || tiacount > 0)
+		{
+			// the previous viewport still depth-tests against the Z-buffer
+			m_renderer->wait_for_polys();
+			m_renderer->clear_zb();
+			m_renderer->draw_opaque_triangles(&m_tri_buffer[ti], ticount);
+			m_renderer->draw_alpha_triangles(&m_tri_alpha_buffer[tia], tiacount);
+		}
 	}
+
+	m_renderer->wait_for_polys();
 }
 
 void model3_renderer::draw(bitmap_rgb32 &bitmap, const rectangle &cliprect)
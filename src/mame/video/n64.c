@@ -32,6 +32,7 @@ TODO:
 #include <algorithm>
 
 #define LOG_RDP_EXECUTION       0
+#define DISPLAY_STATS           0
 
 static FILE* rdp_exec;
 
@@ -1780,6 +1781,26 @@ void n64_rdp::compute_cvg_flip(extent_t* spans, INT32* majorx, INT32* minorx, IN
 	}
 }
 
+// Returns a copy of TMEM that stays valid until the polygons using it have been
+// rendered. Triangles with no load command between them share the same copy.
+
+UINT8* n64_rdp::tmem_snapshot()
+{
+	if (m_tmem_snapshot == NULL)
+	{
+		if (m_tmem_snapshot_count == TMEM_SNAPSHOT_COUNT)
+		{
+			wait("TMEM snapshots");
+			m_tmem_snapshot_count = 0;
+		}
+
+		m_tmem_snapshot = m_tmem_snapshots + (m_tmem_snapshot_count++ << 12);
+		memcpy(m_tmem_snapshot, m_tmem, 0x1000);
+	}
+
+	return m_tmem_snapshot;
+}
+
 void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 {
 	const UINT32* cmd_data = rect ? m_temp_rect_data : m_cmd_data;
@@ -1967,6 +1988,7 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 
 	bool new_object = true;
 	rdp_poly_state* object = NULL;
+	UINT8* tmem = NULL;
 	bool valid = false;
 
 	INT32* minx = flip ? &minxhx : &minxmx;
@@ -2021,7 +2043,7 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 				if(new_object)
 				{
 					object = &object_data_alloc();
-					memcpy(object->m_tmem, m_tmem, 0x1000);
+					tmem = tmem_snapshot();
 					new_object = false;
 				}
 
@@ -2035,7 +2057,7 @@ void n64_rdp::draw_triangle(bool shade, bool texture, bool zbuffer, bool rect)
 				}
 
 				rdp_span_aux* userdata = (rdp_span_aux*)spans[spanidx].userdata;
-				userdata->m_tmem = object->m_tmem;
+				userdata->m_tmem = tmem;
 
 				userdata->m_blend_color = m_blend_color;
 				userdata->m_prim_color = m_prim_color;
@@ -2402,6 +2424,7 @@ void n64_rdp::cmd_set_other_modes(UINT32 w1, UINT32 w2)
 void n64_rdp::cmd_load_tlut(UINT32 w1, UINT32 w2)
 {
 	//wait("LoadTLUT");
+	m_tmem_snapshot = NULL;
 	n64_tile_t* tile = m_tiles;
 
 	const INT32 tilenum = (w2 >> 24) & 0x7;
@@ -2468,6 +2491,7 @@ void n64_rdp::cmd_set_tile_size(UINT32 w1, UINT32 w2)
 void n64_rdp::cmd_load_block(UINT32 w1, UINT32 w2)
 {
 	//wait("LoadBlock");
+	m_tmem_snapshot = NULL;
 	n64_tile_t* tile = m_tiles;
 
 	const INT32 tilenum = (w2 >> 24) & 0x7;
@@ -2633,6 +2657,7 @@ void n64_rdp::cmd_load_block(UINT32 w1, UINT32 w2)
 void n64_rdp::cmd_load_tile(UINT32 w1, UINT32 w2)
 {
 	//wait("LoadTile");
+	m_tmem_snapshot = NULL;
 	n64_tile_t* tile = m_tiles;
 	const INT32 tilenum = (w2 >> 24) & 0x7;
 
@@ -3039,7 +3064,7 @@ void n64_rdp::process_command_list()
 
 /*****************************************************************************/
 
-n64_rdp::n64_rdp(n64_state &state) : poly_manager<UINT32, rdp_poly_state, 8, 32000>(state.machine())
+n64_rdp::n64_rdp(n64_state &state) : poly_manager<UINT32, rdp_poly_state, 8, 32000>(state.machine(), DISPLAY_STATS ? POLYFLAG_TIME_WAITS : 0)
 {
 	ignore = false;
 	dolog = false;
@@ -3061,6 +3086,9 @@ n64_rdp::n64_rdp(n64_state &state) : poly_manager<UINT32, rdp_poly_state, 8, 320
 	m_zero.set(0, 0, 0, 0);
 
 	m_tmem = NULL;
+	m_tmem_snapshots = NULL;
+	m_tmem_snapshot = NULL;
+	m_tmem_snapshot_count = 0;
 
 	m_machine = NULL;
 
@@ -3188,6 +3216,15 @@ UINT32 n64_state::screen_update_n64(screen_device &screen, bitmap_rgb32 &bitmap,
 	m_rdp->wait();
 	m_rdp->m_aux_buf_ptr = 0;
 
+#if DISPLAY_STATS
+{
+	const n64_rdp::frame_stats &stats = m_rdp->stats();
+	popmessage("Polys = %5d  Units = %6d  Pixels = %8d  Waits = %4d  Wait = %5dus", stats.polygons, stats.units, (UINT32)stats.pixels,
+			stats.waits, (int)(stats.wait_ticks * 1000000 / osd_ticks_per_second()));
+	m_rdp->reset_stats();
+}
+#endif
+
 	if (n64->vi_blank)
 	{
 		bitmap.fill(0, m_rdp->m_visarea);
@@ -118,6 +118,7 @@
 #define SPAN_Z      (7)
 
 #define EXTENT_AUX_COUNT            (sizeof(rdp_span_aux)*(480*192)) // Screen coverage *192, more or less
+#define TMEM_SNAPSHOT_COUNT         (256)                            // TMEM images kept alive for in-flight polygons
 
 /*****************************************************************************/
 
@@ -142,6 +143,10 @@ public:
 		m_tmem = auto_alloc_array(machine(), UINT8, 0x1000);
 		memset(m_tmem, 0, 0x1000);
 
+		m_tmem_snapshots = auto_alloc_array(machine(), UINT8, TMEM_SNAPSHOT_COUNT * 0x1000);
+		m_tmem_snapshot = NULL;
+		m_tmem_snapshot_count = 0;
+
 		UINT8* normpoint = machine().root_device().memregion("normpoint")->base();
 		UINT8* normslope = machine().root_device().memregion("normslope")->base();
 
@@ -327,6 +332,8 @@ private:
 	void    compute_cvg_noflip(extent_t* spans, INT32* majorx, INT32* minorx, INT32* majorxint, INT32* minorxint, INT32 scanline, INT32 yh, INT32 yl, INT32 base);
 	void    compute_cvg_flip(extent_t* spans, INT32* majorx, INT32* minorx, INT32* majorxint, INT32* minorxint, INT32 scanline, INT32 yh, INT32 yl, INT32 base);
 
+	UINT8*  tmem_snapshot();
+
 	void    write_pixel(UINT32 curpixel, color_t& color, rdp_span_aux* userdata, const rdp_poly_state &object);
 	void    read_pixel(UINT32 curpixel, rdp_span_aux* userdata, const rdp_poly_state &object);
 	void    copy_pixel(UINT32 curpixel, color_t& color, const rdp_poly_state &object);
@@ -366,6 +373,12 @@ private:
 
 	UINT8*  m_tmem;
 
+	// Copies of TMEM handed to the span renderers; a new one is only taken
+	// once a load command has changed TMEM since the last triangle
+	UINT8*  m_tmem_snapshots;
+	UINT8*  m_tmem_snapshot;
+	INT32   m_tmem_snapshot_count;
+
 	// YUV factors
 	color_t m_k023;
 	color_t m_k1;
@@ -254,7 +254,6 @@ struct rdp_poly_state
 	rectangle_t         m_scissor;              /* screen-space scissor bounds */
 	UINT32              m_fill_color;           /* poly fill color */
 	n64_tile_t          m_tiles[8];             /* texture tile state */
-	UINT8               m_tmem[0x1000];         /* texture cache */
 	INT32               tilenum;                /* texture tile index */
 	bool                flip;                   /* left-major / right-major flip */
 	bool                rect;                   /* primitive is rectangle (vs. triangle) */
@@ -64,7 +64,17 @@ void namcos22_renderer::reset()
 /*********************************************************************************************/
 
 // polynew scanline callbacks
-void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, int threadid)
+
+// fog modes, resolved once per span instead of once per pixel
+enum
+{
+	FOG_NONE = 0,   // no fog, or a direct fog factor of zero
+	FOG_DIRECT,     // constant fog factor preset by the polygon
+	FOG_Z           // per-pixel fog factor looked up from czram
+};
+
+template<bool _Super, int _FogMode>
+void namcos22_renderer::renderspan_uvi(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, const pen_t *pens, int penmask, int penshift)
 {
 	float z = extent.param[0].start;
 	float u = extent.param[1].start;
@@ -75,11 +85,9 @@ void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &
 	float dv = extent.param[2].dpdx;
 	float di = extent.param[3].dpdx;
 	int bn = extra.bn * 0x1000;
-	const pen_t *pens = extra.pens;
 	const UINT8 *czram = extra.czram;
 	int cz_adjust = extra.cz_adjust;
 	int cz_sdelta = extra.cz_sdelta;
-	int zfog_enabled = extra.zfog_enabled;
 	int fogfactor = 0xff - extra.fogfactor;
 	int fadefactor = 0xff - extra.fadefactor;
 	int alphafactor = 0xff - m_state.m_poly_translucency;
@@ -87,8 +95,6 @@ void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &
 	rgbaint_t fadecolor = extra.fadecolor;
 	rgbaint_t polycolor = extra.polycolor;
 	int polyfade_enabled = extra.pfade_enabled;
-	int penmask = 0xff;
-	int penshift = 0;
 	int prioverchar = extra.prioverchar;
 	UINT32 *dest = &extra.destbase->pix32(scanline);
 	UINT8 *primap = &extra.primap->pix8(scanline);
@@ -97,46 +103,33 @@ void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &
 	UINT8 *ttdata = m_state.m_texture_tiledata;
 	UINT8 *tt_ayx_to_pixel = m_state.m_texture_ayx_to_pixel;
 
-	if (extra.cmode & 4)
-	{
-		pens += 0xec + ((extra.cmode & 8) << 1);
-		penmask = 0x03;
-		penshift = 2 * (~extra.cmode & 3);
-	}
-	else if (extra.cmode & 2)
-	{
-		pens += 0xe0 + ((extra.cmode & 8) << 1);
-		penmask = 0x0f;
-		penshift = 4 * (~extra.cmode & 1);
-	}
-
-	// slight differences between super and non-super, do the branch here for optimization
-	// normal: 1 fader, no alpha, shading after fog
-	// super:  2 faders, alpha, shading before fog
-	if (m_state.m_is_ss22)
+	for (int x = extent.startx; x < extent.stopx; x++)
 	{
-		for (int x = extent.startx; x < extent.stopx; x++)
-		{
-			float ooz = 1.0f / z;
-			INT32 tx = (int)(u * ooz);
-			INT32 ty = (int)(v * ooz) + bn;
-			INT32 to = ((ty & 0xfff0) << 4) | ((tx & 0xff0) >> 4);
-			INT32 pen = ttdata[(ttmap[to] << 8) | tt_ayx_to_pixel[ttattr[to] << 8 | (ty << 4 & 0xf0) | (tx & 0xf)]];
-			// pen = 0x55; // debug: disable textures
+		float ooz = 1.0f / z;
+		INT32 tx = (int)(u * ooz);
+		INT32 ty = (int)(v * ooz) + bn;
+		INT32 to = ((ty & 0xfff0) << 4) | ((tx & 0xff0) >> 4);
+		INT32 pen = ttdata[(ttmap[to] << 8) | tt_ayx_to_pixel[ttattr[to] << 8 | (ty << 4 & 0xf0) | (tx & 0xf)]];
+		// pen = 0x55; // debug: disable textures
 
-			rgbaint_t rgb(pens[pen >> penshift & penmask]);
+		rgbaint_t rgb(pens[pen >> penshift & penmask]);
 
-			// apply shading before fog
+		// super: apply shading before fog
+		if (_Super)
+		{
 			INT32 shade = i*ooz;
 			rgb.scale_imm_and_clamp(shade << 2);
+		}
 
-			// per-z distance fogging
-			if (zfog_enabled)
+		// per-z distance fogging
+		if (_FogMode == FOG_Z)
+		{
+			int cz = ooz + cz_adjust;
+			// discard low byte and clamp to 0-1fff
+			if ((UINT32)cz < 0x200000) cz >>= 8;
+			else cz = (cz < 0) ? 0 : 0x1fff;
+			if (_Super)
 			{
-				int cz = ooz + cz_adjust;
-				// discard low byte and clamp to 0-1fff
-				if ((UINT32)cz < 0x200000) cz >>= 8;
-				else cz = (cz < 0) ? 0 : 0x1fff;
 				fogfactor = czram[cz] + cz_sdelta;
 				if (fogfactor > 0)
 				{
@@ -144,16 +137,34 @@ void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &
 					rgb.blend(fogcolor, 0xff - fogfactor);
 				}
 			}
-			else if (fogfactor != 0xff) // direct
+			else
 			{
-				rgb.blend(fogcolor, fogfactor);
+				fogfactor = czram[NATIVE_ENDIAN_VALUE_LE_BE(3, 0) ^ cz];
+				if (fogfactor != 0)
+				{
+					rgb.blend(fogcolor, 0xff - fogfactor);
+				}
 			}
+		}
+		else if (_FogMode == FOG_DIRECT)
+		{
+			rgb.blend(fogcolor, fogfactor);
+		}
 
-			if (polyfade_enabled)
-			{
-				rgb.scale_and_clamp(polycolor);
-			}
+		// normal: apply shading after fog
+		if (!_Super)
+		{
+			INT32 shade = i*ooz;
+			rgb.scale_imm_and_clamp(shade << 2);
+		}
 
+		if (polyfade_enabled)
+		{
+			rgb.scale_and_clamp(polycolor);
+		}
+
+		if (_Super)
+		{
 			if (fadefactor != 0xff)
 			{
 				rgb.blend(fadecolor, fadefactor);
@@ -163,63 +174,59 @@ void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &
 			{
 				rgb.blend(rgbaint_t(dest[x]), alphafactor);
 			}
-
-			dest[x] = rgb.to_rgba();
-			primap[x] |= prioverchar;
-
-			u += du;
-			v += dv;
-			i += di;
-			z += dz;
 		}
-	}
-	else
-	{
-		for (int x = extent.startx; x < extent.stopx; x++)
-		{
-			float ooz = 1.0f / z;
-			int tx = (int)(u * ooz);
-			int ty = (int)(v * ooz) + bn;
-			int to = ((ty & 0xfff0) << 4) | ((tx & 0xff0) >> 4);
-			int pen = ttdata[(ttmap[to] << 8) | tt_ayx_to_pixel[ttattr[to] << 8 | (ty << 4 & 0xf0) | (tx & 0xf)]];
-			// pen = 0x55; // debug: disable textures
 
-			rgbaint_t rgb(pens[pen >> penshift & penmask]);
+		dest[x] = rgb.to_rgba();
+		primap[x] |= prioverchar;
 
-			// per-z distance fogging
-			if (zfog_enabled)
-			{
-				int cz = ooz + cz_adjust;
-				// discard low byte and clamp to 0-1fff
-				if ((UINT32)cz < 0x200000) cz >>= 8;
-				else cz = (cz < 0) ? 0 : 0x1fff;
-				fogfactor = czram[NATIVE_ENDIAN_VALUE_LE_BE(3, 0) ^ cz];
-				if (fogfactor != 0)
-				{
-					rgb.blend(fogcolor, 0xff - fogfactor);
-				}
-			}
-			else if (fogfactor != 0xff) // direct
-			{
-				rgb.blend(fogcolor, fogfactor);
-			}
+		u += du;
+		v += dv;
+		i += di;
+		z += dz;
+	}
+}
 
-			// apply shading after fog
-			int shade = i*ooz;
-			rgb.scale_imm_and_clamp(shade << 2);
+void namcos22_renderer::renderscanline_uvi_full(INT32 scanline, const extent_t &extent, const namcos22_object_data &extra, int threadid)
+{
+	const pen_t *pens = extra.pens;
+	int penmask = 0xff;
+	int penshift = 0;
 
-			if (polyfade_enabled)
-			{
-				rgb.scale_and_clamp(polycolor);
-			}
+	if (extra.cmode & 4)
+	{
+		pens += 0xec + ((extra.cmode & 8) << 1);
+		penmask = 0x03;
+		penshift = 2 * (~extra.cmode & 3);
+	}
+	else if (extra.cmode & 2)
+	{
+		pens += 0xe0 + ((extra.cmode & 8) << 1);
+		penmask = 0x0f;
+		penshift = 4 * (~extra.cmode & 1);
+	}
 
-			dest[x] = rgb.to_rgba();
-			primap[x] |= prioverchar;
+	// slight differences between super and non-super, do the branch here for optimization
+	// normal: 1 fader, no alpha, shading after fog
+	// super:  2 faders, alpha, shading before fog
+	// the fog mode is also constant for the whole polygon, so pick a specialised span loop
+	int fogmode = extra.zfog_enabled ? FOG_Z : (extra.fogfactor != 0) ? FOG_DIRECT : FOG_NONE;
 
-			u += du;
-			v += dv;
-			i += di;
-			z += dz;
+	if (m_state.m_is_ss22)
+	{
+		switch (fogmode)
+		{
+			case FOG_Z:      renderspan_uvi<true, FOG_Z>(scanline, extent, extra, pens, penmask, penshift); break;
+			case FOG_DIRECT: renderspan_uvi<true, FOG_DIRECT>(scanline, extent, extra, pens, penmask, penshift); break;
+			default:         renderspan_uvi<true, FOG_NONE>(scanline, extent, extra, pens, penmask, penshift); break;
+		}
+	}
+	else
+	{
+		switch (fogmode)
+		{
+			case FOG_Z:      renderspan_uvi<false, FOG_Z>(scanline, extent, extra, pens, penmask, penshift); break;
+			case FOG_DIRECT: renderspan_uvi<false, FOG_DIRECT>(scanline, extent, extra, pens, penmask, penshift); break;
+			default:         renderspan_uvi<false, FOG_NONE>(scanline, extent, extra, pens, penmask, penshift); break;
 		}
 	}
 }
@@ -2396,8 +2403,7 @@ void namcos22_state::init_tables()
 	m_pointram = auto_alloc_array_clear(machine(), UINT32, 0x20000);
 
 	// force all texture tiles to be decoded now
-	for (int i = 0; i < m_gfxdecode->gfx(1)->elements(); i++)
-		m_gfxdecode->gfx(1)->get_data(i);
+	m_gfxdecode->gfx(1)->decode_all();
 
 	m_texture_tilemap = (UINT16 *)memregion("textilemap")->base();
 	m_texture_tiledata = (UINT8 *)m_gfxdecode->gfx(1)->get_data(0);
@@ -956,11 +956,10 @@ WRITE32_MEMBER( powervr2_device::startrender_w )
 
 			rectangle clip(0, 1023, 0, 1023);
 
-			// we've got a request to draw, so, draw to the accumulation buffer!
-			// this should really be done for each tile!
+			// we've got a request to draw, so, bin the triangles and start rendering the accumulation buffer tiles
 			render_to_accumulation_buffer(*fake_accumulationbuffer_bitmap,clip);
 
-			/* copy the tiles to the framebuffer (really the rendering should be in this loop too) */
+			/* copy the tiles to the framebuffer as each one completes */
 			int sizera = fpu_param_cfg & 0x200000 ? 6 : 5;
 			int offsetra=region_base;
 
@@ -995,6 +994,7 @@ WRITE32_MEMBER( powervr2_device::startrender_w )
 					// instead just use these co-ordinates to copy data from our fake full-screnen accumnulation buffer into
 					// the framebuffer
 
+					finish_tile(x, y);
 					pvr_accumulationbuffer_to_framebuffer(space, x,y);
 				}
 
@@ -1006,6 +1006,7 @@ WRITE32_MEMBER( powervr2_device::startrender_w )
 				//if(sanitycount>2000)
 				//  break;
 			}
+			finish_render();
 //          printf("ISP START %d %d\n",sanitycount,m_screen->vpos());
 			/* Fire ISP irq after a set amount of time TODO: timing of this */
 			endofrender_timer_isp->adjust(state->m_maincpu->cycles_to_attotime(sanitycount*25));
@@ -2167,7 +2168,7 @@ void powervr2_device::computedilated()
 			dilatechose[(b << 3) + a]=3+(a < b ? a : b);
 }
 
-void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr)
+void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr)
 {
 	int xxl, xxr;
 	float dx, ddx, dudx, dvdx, dwdx;
@@ -2177,7 +2178,7 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	// untextured cases aren't handled
 //  if (!ti->textured) return;
 
-	if(xr < 0 || xl >= 640)
+	if(xr < clip.min_x || xl >= clip.max_x + 1)
 		return;
 
 	xxl = round(xl);
@@ -2191,10 +2192,10 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	dvdx = (vr-vl)/dx;
 	dwdx = (wr-wl)/dx;
 
-	if(xxl < 0)
-		xxl = 0;
-	if(xxr > 640)
-		xxr = 640;
+	if(xxl < clip.min_x)
+		xxl = clip.min_x;
+	if(xxr > clip.max_x + 1)
+		xxr = clip.max_x + 1;
 
 	// Target the pixel center
 	ddx = xxl + 0.5f - xl;
@@ -2252,7 +2253,7 @@ void powervr2_device::render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, flo
 	}
 }
 
-void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip,
 									float y0, float y1,
 									float xl, float xr,
 									float ul, float ur,
@@ -2266,21 +2267,22 @@ void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	float dy;
 	int yy0, yy1;
 
-	if(y1 <= 0)
+	if(y1 <= clip.min_y)
 		return;
-	if(y1 > 480)
-		y1 = 480;
-
-	if(y0 < 0) {
-		xl += -dxldy*y0;
-		xr += -dxrdy*y0;
-		ul += -duldy*y0;
-		ur += -durdy*y0;
-		vl += -dvldy*y0;
-		vr += -dvrdy*y0;
-		wl += -dwldy*y0;
-		wr += -dwrdy*y0;
-		y0 = 0;
+	if(y1 > clip.max_y + 1)
+		y1 = clip.max_y + 1;
+
+	if(y0 < clip.min_y) {
+		float skip = clip.min_y - y0;
+		xl += dxldy*skip;
+		xr += dxrdy*skip;
+		ul += duldy*skip;
+		ur += durdy*skip;
+		vl += dvldy*skip;
+		vr += dvrdy*skip;
+		wl += dwldy*skip;
+		wr += dwrdy*skip;
+		y0 = clip.min_y;
 	}
 
 	yy0 = round(y0);
@@ -2306,7 +2308,7 @@ void powervr2_device::render_span(bitmap_rgb32 &bitmap, texinfo *ti,
 	wr += dy*dwrdy;
 
 	while(yy0 < yy1) {
-		render_hline(bitmap, ti, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
+		render_hline(bitmap, ti, clip, yy0, xl, xr, ul, ur, vl, vr, wl, wr);
 
 		xl += dxldy;
 		xr += dxrdy;
@@ -2351,13 +2353,13 @@ void powervr2_device::sort_vertices(const vert *v, int *i0, int *i1, int *i2)
 }
 
 
-void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2)
+void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, const vert *v0, const vert *v1, const vert *v2)
 {
 	float dy01, dy02, dy12;
 
 	float dx01dy, dx02dy, dx12dy, du01dy, du02dy, du12dy, dv01dy, dv02dy, dv12dy, dw01dy, dw02dy, dw12dy;
 
-	if(v0->y >= 480 || v2->y < 0)
+	if(v0->y >= clip.max_y + 1 || v2->y < clip.min_y)
 		return;
 
 	dy01 = v1->y - v0->y;
@@ -2385,41 +2387,132 @@ void powervr2_device::render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const
 			return;
 
 		if(v1->x > v0->x)
-			render_span(bitmap, ti, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
+			render_span(bitmap, ti, clip, v1->y, v2->y, v0->x, v1->x, v0->u, v1->u, v0->v, v1->v, v0->w, v1->w, dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		else
-			render_span(bitmap, ti, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
+			render_span(bitmap, ti, clip, v1->y, v2->y, v1->x, v0->x, v1->u, v0->u, v1->v, v0->v, v1->w, v0->w, dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 
 	} else if(!dy12) {
 		if(v2->x > v1->x)
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
+			render_span(bitmap, ti, clip, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
 		else
-			render_span(bitmap, ti, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
+			render_span(bitmap, ti, clip, v0->y, v1->y, v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w, dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
 
 	} else {
 		if(dx01dy < dx02dy) {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, ti, clip, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx01dy, dx02dy, du01dy, du02dy, dv01dy, dv02dy, dw01dy, dw02dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, ti, clip, v1->y, v2->y,
 						v1->x, v0->x + dx02dy*dy01, v1->u, v0->u + du02dy*dy01, v1->v, v0->v + dv02dy*dy01, v1->w, v0->w + dw02dy*dy01,
 						dx12dy, dx02dy, du12dy, du02dy, dv12dy, dv02dy, dw12dy, dw02dy);
 		} else {
-			render_span(bitmap, ti, v0->y, v1->y,
+			render_span(bitmap, ti, clip, v0->y, v1->y,
 						v0->x, v0->x, v0->u, v0->u, v0->v, v0->v, v0->w, v0->w,
 						dx02dy, dx01dy, du02dy, du01dy, dv02dy, dv01dy, dw02dy, dw01dy);
-			render_span(bitmap, ti, v1->y, v2->y,
+			render_span(bitmap, ti, clip, v1->y, v2->y,
 						v0->x + dx02dy*dy01, v1->x, v0->u + du02dy*dy01, v1->u, v0->v + dv02dy*dy01, v1->v, v0->w + dw02dy*dy01, v1->w,
 						dx02dy, dx12dy, du02dy, du12dy, dv02dy, dv12dy, dw02dy, dw12dy);
 		}
 	}
 }
 
-void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v)
+void powervr2_device::render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, const vert *v)
 {
 	int i0, i1, i2;
 
 	sort_vertices(v, &i0, &i1, &i2);
-	render_tri_sorted(bitmap, ti, v+i0, v+i1, v+i2);
+	render_tri_sorted(bitmap, ti, clip, v+i0, v+i1, v+i2);
+}
+
+// add a triangle to the list of every tile its bounding box touches
+void powervr2_device::bin_tri(int strip, int vertnum, const vert *v)
+{
+	float minx = v[0].x, maxx = v[0].x, miny = v[0].y, maxy = v[0].y;
+	for(int i=1; i < 3; i++) {
+		if(v[i].x < minx) minx = v[i].x;
+		if(v[i].x > maxx) maxx = v[i].x;
+		if(v[i].y < miny) miny = v[i].y;
+		if(v[i].y > maxy) maxy = v[i].y;
+	}
+
+	// written so that NaN coordinates are rejected too
+	if(!(maxx >= 0 && minx < 640 && maxy >= 0 && miny < 480))
+		return;
+
+	// pad by a pixel to stay conservative about span rounding
+	int tx0 = minx < 1 ? 0 : (int(minx) - 1) / TILE_SIZE;
+	int ty0 = miny < 1 ? 0 : (int(miny) - 1) / TILE_SIZE;
+	int tx1 = maxx >= 639 ? TILES_X - 1 : (int(maxx) + 1) / TILE_SIZE;
+	int ty1 = maxy >= 479 ? TILES_Y - 1 : (int(maxy) + 1) / TILE_SIZE;
+
+	tile_tri tri;
+	tri.strip = strip;
+	tri.vert = vertnum;
+	for(int ty=ty0; ty <= ty1; ty++)
+		for(int tx=tx0; tx <= tx1; tx++)
+			m_tiles[ty * TILES_X + tx].tris.push_back(tri);
+}
+
+void powervr2_device::render_tile_tris(render_tile &tile)
+{
+	receiveddata &rd = grab[renderselect];
+
+	if(tile.tris.empty())
+		return;
+
+	for(int y=tile.clip.min_y; y <= tile.clip.max_y; y++)
+		memset(&wbuffer[y][tile.clip.min_x], 0x00, TILE_SIZE * sizeof(float));
+
+	for(size_t i=0; i < tile.tris.size(); i++) {
+		const tile_tri &tri = tile.tris[i];
+		render_tri(*m_render_bitmap, &rd.strips[tri.strip].ti, tile.clip, rd.verts + tri.vert);
+	}
+}
+
+void *powervr2_device::render_tile_callback(void *param, int threadid)
+{
+	render_tile &tile = *(render_tile *)param;
+
+	// the emulation thread may already have claimed this tile to copy it out
+	if(compare_exchange32(&tile.state, 0, 1) == 0) {
+		tile.owner->render_tile_tris(tile);
+		atomic_exchange32(&tile.state, 2);
+	}
+	return NULL;
+}
+
+// make sure the accumulation buffer tile at (x,y) is complete, rendering it
+// here if no worker thread has picked it up yet
+void powervr2_device::finish_tile(int x, int y)
+{
+	if(x >= 640 || y >= 480)
+		return;
+
+	render_tile &tile = m_tiles[(y / TILE_SIZE) * TILES_X + x / TILE_SIZE];
+	if(compare_exchange32(&tile.state, 0, 1) == 0) {
+		render_tile_tris(tile);
+		atomic_exchange32(&tile.state, 2);
+	}
+	else
+		// read through an atomic so the worker's framebuffer writes are
+		// visible once we see the tile marked done
+		while(atomic_add32(&tile.state, 0) != 2)
+			osd_yield_processor();
+}
+
+void powervr2_device::finish_render()
+{
+	if(renderselect < 0)
+		return;
+
+	for(int y=0; y < 480; y += TILE_SIZE)
+		for(int x=0; x < 640; x += TILE_SIZE)
+			finish_tile(x, y);
+
+	// wait for the work items themselves to retire before the tiles are reused
+	if (m_render_queue != NULL)
+		osd_work_queue_wait(m_render_queue, osd_ticks_per_second() * 10);
+	grab[renderselect].busy=0;
 }
 
 void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const rectangle &cliprect)
@@ -2444,8 +2537,12 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 
 
 	int ns=grab[rs].strips_size;
-	if(ns)
-		memset(wbuffer, 0x00, sizeof(wbuffer));
+	for (int t=0;t < TILES_X * TILES_Y;t++)
+	{
+		m_tiles[t].tris.clear();
+		m_tiles[t].state = 0;
+	}
+	m_render_bitmap = &bitmap;
 
 	for (int cs=0;cs < ns;cs++)
 	{
@@ -2466,11 +2563,18 @@ void powervr2_device::render_to_accumulation_buffer(bitmap_rgb32 &bitmap,const r
 		for(i=sv; i <= ev-2; i++)
 		{
 			if (!(debug_dip_status&0x2))
-				render_tri(bitmap, &ts->ti, grab[rs].verts + i);
+				bin_tri(cs, i, grab[rs].verts + i);
 
 		}
 	}
-	grab[rs].busy=0;
+
+	// the tiles are finished off by finish_tile()/finish_render() as they are copied out;
+	// without a queue, render them all here
+	if (m_render_queue != NULL)
+		osd_work_item_queue_multiple(m_render_queue, render_tile_callback, TILES_X * TILES_Y, m_tiles, sizeof(m_tiles[0]), WORK_ITEM_FLAG_AUTO_RELEASE);
+	else
+		for (int t=0;t < TILES_X * TILES_Y;t++)
+			render_tile_callback(&m_tiles[t], 0);
 }
 
 // copies the accumulation buffer into the framebuffer, converting to the specified format
@@ -3627,6 +3731,15 @@ void powervr2_device::device_start()
 
 	fake_accumulationbuffer_bitmap = auto_bitmap_rgb32_alloc(machine(),2048,2048);
 
+	m_render_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI);
+	m_render_bitmap = NULL;
+	for (int t=0;t < TILES_X * TILES_Y;t++)
+	{
+		m_tiles[t].owner = this;
+		m_tiles[t].clip.set((t % TILES_X) * TILE_SIZE, (t % TILES_X) * TILE_SIZE + TILE_SIZE - 1, (t / TILES_X) * TILE_SIZE, (t / TILES_X) * TILE_SIZE + TILE_SIZE - 1);
+		m_tiles[t].state = 2;
+	}
+
 	softreset = 0;
 	param_base = 0;
 	region_base = 0;
@@ -3742,6 +3855,13 @@ void powervr2_device::device_start()
 	save_item(NAME(next_y));
 }
 
+void powervr2_device::device_stop()
+{
+	if (m_render_queue != NULL)
+		osd_work_queue_free(m_render_queue);
+	m_render_queue = NULL;
+}
+
 void powervr2_device::device_reset()
 {
 	softreset =                 0x00000007;
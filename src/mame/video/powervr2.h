@@ -54,7 +54,7 @@ public:
 
 
 	// the real accumulation buffer is a 32x32x8bpp buffer into which tiles get rendered before they get copied to the framebuffer
-	//  our implementation is not currently tile based, and thus the accumulation buffer is screen sized
+	//  our implementation renders 32x32 tiles in parallel, but into a single screen sized accumulation buffer
 	bitmap_rgb32 *fake_accumulationbuffer_bitmap;
 
 	struct texinfo  {
@@ -80,6 +80,23 @@ public:
 		texinfo ti;
 	};
 
+	// the accumulation buffer is rendered in 32x32 tiles, each of which is
+	// handed to a worker thread with the list of triangles that touch it
+	enum { TILE_SIZE = 32, TILES_X = 640 / TILE_SIZE, TILES_Y = 480 / TILE_SIZE };
+
+	struct tile_tri
+	{
+		UINT16 strip, vert;
+	};
+
+	struct render_tile
+	{
+		powervr2_device *owner;
+		rectangle clip;
+		std::vector<tile_tri> tris;
+		volatile INT32 state;
+	};
+
 	struct receiveddata {
 		vert verts[65536];
 		strip strips[65536];
@@ -281,6 +298,7 @@ public:
 
 protected:
 	virtual void device_start();
+	virtual void device_stop();
 	virtual void device_reset();
 
 private:
@@ -298,6 +316,11 @@ private:
 	UINT32 text_control;
 	UINT32 pal_ram_ctrl;
 
+	// tiled rendering
+	osd_work_queue *m_render_queue;
+	render_tile m_tiles[TILES_X * TILES_Y];
+	bitmap_rgb32 *m_render_bitmap;
+
 	// TA registers
 	UINT32 ta_ol_base, ta_ol_limit, ta_isp_base, ta_isp_limit;
 	UINT32 ta_next_opb, ta_itp_current, ta_alloc_ctrl, ta_next_opb_init;
@@ -429,8 +452,8 @@ private:
 	UINT32 tex_r_default(texinfo *t, float x, float y);
 	void tex_get_info(texinfo *t);
 
-	void render_hline(bitmap_rgb32 &bitmap, texinfo *ti, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr);
-	void render_span(bitmap_rgb32 &bitmap, texinfo *ti,
+	void render_hline(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, int y, float xl, float xr, float ul, float ur, float vl, float vr, float wl, float wr);
+	void render_span(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip,
 						float y0, float y1,
 						float xl, float xr,
 						float ul, float ur,
@@ -441,8 +464,13 @@ private:
 						float dvldy, float dvrdy,
 						float dwldy, float dwrdy);
 	void sort_vertices(const vert *v, int *i0, int *i1, int *i2);
-	void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v0, const vert *v1, const vert *v2);
-	void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const vert *v);
+	void render_tri_sorted(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, const vert *v0, const vert *v1, const vert *v2);
+	void render_tri(bitmap_rgb32 &bitmap, texinfo *ti, const rectangle &clip, const vert *v);
+	void bin_tri(int strip, int vertnum, const vert *v);
+	void render_tile_tris(render_tile &tile);
+	static void *render_tile_callback(void *param, int threadid);
+	void finish_tile(int x, int y);
+	void finish_render();
 	void render_to_accumulation_buffer(bitmap_rgb32 &bitmap, const rectangle &cliprect);
 	void pvr_accumulationbuffer_to_framebuffer(address_space &space, int x, int y);
 	void pvr_drawframebuffer(bitmap_rgb32 &bitmap,const rectangle &cliprect);
@@ -664,6 +664,7 @@ VIDEO_START_MEMBER(taito_f3_state,f3)
 		gfx_element *sprite_gfx = m_gfxdecode->gfx(2);
 		int c;
 
+		sprite_gfx->decode_all();
 		for (c = 0;c < sprite_gfx->elements();c++)
 		{
 			int x,y;
@@ -688,6 +689,7 @@ VIDEO_START_MEMBER(taito_f3_state,f3)
 		gfx_element *pf_gfx = m_gfxdecode->gfx(1);
 		int c;
 
+		pf_gfx->decode_all();
 		for (c = 0;c < pf_gfx->elements();c++)
 		{
 			int x,y;
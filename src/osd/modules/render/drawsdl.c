@@ -61,6 +61,7 @@ public:
 	#endif
 	m_yuv_lookup(NULL),
 	m_yuv_bitmap(NULL),
+	m_work_queue(NULL),
 	//m_hw_scale_width(0),
 	//m_hw_scale_height(0),
 	m_last_hofs(0),
@@ -111,6 +112,9 @@ private:
 	UINT32              *m_yuv_lookup;
 	UINT16              *m_yuv_bitmap;
 
+	// queue for banded software rendering
+	osd_work_queue      *m_work_queue;
+
 	// if we leave scaling to SDL and the underlying driver, this
 	// is the render_target_width/height to use
 
@@ -430,6 +434,8 @@ static void drawsdl_show_info(struct SDL_RendererInfo *render_info)
 
 int sdl_info::create()
 {
+	m_work_queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+
 #if (SDLMAME_SDL2)
 	const sdl_scale_mode *sm = &scale_modes[video_config.scale_mode];
 
@@ -509,6 +515,11 @@ void sdl_info::destroy()
 		global_free_array(m_yuv_bitmap);
 		m_yuv_bitmap = NULL;
 	}
+	if (m_work_queue != NULL)
+	{
+		osd_work_queue_free(m_work_queue);
+		m_work_queue = NULL;
+	}
 #if (SDLMAME_SDL2)
 	SDL_DestroyRenderer(m_sdl_renderer);
 #endif
@@ -737,23 +748,23 @@ int sdl_info::draw(int update)
 		switch (rmask)
 		{
 			case 0x0000ff00:
-				software_renderer<UINT32, 0,0,0, 8,16,24>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 8,16,24>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0x00ff0000:
-				software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 16,8,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0x000000ff:
-				software_renderer<UINT32, 0,0,0, 0,8,16>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4);
+				software_renderer<UINT32, 0,0,0, 0,8,16>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 4, m_work_queue);
 				break;
 
 			case 0xf800:
-				software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<UINT16, 3,2,3, 11,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue);
 				break;
 
 			case 0x7c00:
-				software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2);
+				software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, surfptr, mamewidth, mameheight, pitch / 2, m_work_queue);
 				break;
 
 			default:
@@ -765,7 +776,7 @@ int sdl_info::draw(int update)
 	{
 		assert (m_yuv_bitmap != NULL);
 		assert (surfptr != NULL);
-		software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, m_yuv_bitmap, mamewidth, mameheight, mamewidth);
+		software_renderer<UINT16, 3,3,3, 10,5,0>::draw_primitives(*window().m_primlist, m_yuv_bitmap, mamewidth, mameheight, mamewidth, m_work_queue);
 		sm->yuv_blit((UINT16 *)m_yuv_bitmap, surfptr, pitch, m_yuv_lookup, mamewidth, mameheight);
 	}
 
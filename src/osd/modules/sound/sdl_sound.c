@@ -50,7 +50,6 @@ public:
 	sound_sdl()
 	: osd_module(OSD_SOUND_PROVIDER, "sdl"), sound_module(),
 		stream_in_initialized(0),
-		stream_loop(0),
 		attenuation(0)
 	{
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
@@ -66,31 +65,31 @@ public:
 	virtual void set_mastervolume(int attenuation);
 
 private:
-	int lock_buffer(bool is_throttled, long offset, long size, void **buffer1, long *length1, void **buffer2, long *length2);
-	void unlock_buffer(void);
 	void att_memcpy(void *dest, const INT16 *data, int bytes_to_copy);
-	void copy_sample_data(bool is_throttled, const INT16 *data, int bytes_to_copy);
+	void copy_sample_data(const INT16 *data, int bytes_to_copy);
 	int sdl_create_buffers(void);
 	void sdl_destroy_buffers(void);
 
 	int sdl_xfer_samples;
 	int stream_in_initialized;
-	int stream_loop;
 	int attenuation;
 
-	int              buf_locked;
-
+	// the stream buffer is a single-producer/single-consumer ring: the
+	// emulation thread owns stream_buffer_in, the SDL callback owns
+	// stream_playpos, and stream_fill (updated atomically by both) is
+	// the only state they share, so neither side ever takes a lock
 	INT8             *stream_buffer;
-	volatile INT32   stream_playpos;
-
 	UINT32           stream_buffer_size;
 	UINT32           stream_buffer_in;
+	UINT32           stream_playpos;
+	volatile INT32   stream_fill;
+	UINT32           stream_target_fill;
 
-	// buffer over/underflow counts
+	// buffer over/underflow counts; each is written by one side only
 	int              buffer_underflows;
 	int              buffer_overflows;
-
-
+	volatile INT32   callback_underflows;
+	volatile INT32   lowest_fill;
 };
 
 
@@ -112,72 +111,6 @@ static FILE *sound_log;
 //  sound_sdl - destructor
 //============================================================
 
-//============================================================
-//  lock_buffer
-//============================================================
-int sound_sdl::lock_buffer(bool is_throttled, long offset, long size, void **buffer1, long *length1, void **buffer2, long *length2)
-{
-	volatile long pstart, pend, lstart, lend;
-
-	if (!buf_locked)
-	{
-		if (is_throttled)
-		{
-			pstart = stream_playpos;
-			pend = (pstart + sdl_xfer_samples);
-			lstart = offset;
-			lend = lstart+size;
-			while (((pstart >= lstart) && (pstart <= lend)) ||
-					((pend >= lstart) && (pend <= lend)))
-			{
-				pstart = stream_playpos;
-				pend = pstart + sdl_xfer_samples;
-			}
-		}
-
-		SDL_LockAudio();
-		buf_locked++;
-	}
-
-	// init lengths
-	*length1 = *length2 = 0;
-
-	if ((offset + size) > stream_buffer_size)
-	{
-		// 2-piece case
-		*length1 = stream_buffer_size - offset;
-		*buffer1 = &stream_buffer[offset];
-		*length2 = size - *length1;
-		*buffer2 = stream_buffer;
-	}
-	else
-	{
-		// normal 1-piece case
-		*length1 = size;
-		*buffer1 = &stream_buffer[offset];
-	}
-
-	if (LOG_SOUND)
-		fprintf(sound_log, "locking %ld bytes at offset %ld (total %d, playpos %d): len1 %ld len2 %ld\n",
-			size, offset, stream_buffer_size, stream_playpos, *length1, *length2);
-
-	return 0;
-}
-
-//============================================================
-//  unlock_buffer
-//============================================================
-void sound_sdl::unlock_buffer(void)
-{
-	buf_locked--;
-	if (!buf_locked)
-		SDL_UnlockAudio();
-
-	if (LOG_SOUND)
-		fprintf(sound_log, "unlocking\n");
-
-}
-
 //============================================================
 //  Apply attenuation
 //============================================================
@@ -198,47 +131,23 @@ void sound_sdl::att_memcpy(void *dest, const INT16 *data, int bytes_to_copy)
 //  copy_sample_data
 //============================================================
 
-void sound_sdl::copy_sample_data(bool is_throttled, const INT16 *data, int bytes_to_copy)
+void sound_sdl::copy_sample_data(const INT16 *data, int bytes_to_copy)
 {
-	void *buffer1, *buffer2 = (void *)NULL;
-	long length1, length2;
-	int cur_bytes;
+	// copy the first chunk, up to the end of the buffer
+	int cur_bytes = MIN(bytes_to_copy, (int)(stream_buffer_size - stream_buffer_in));
+	att_memcpy(stream_buffer + stream_buffer_in, data, cur_bytes);
 
-	// attempt to lock the stream buffer
-	if (lock_buffer(is_throttled, stream_buffer_in, bytes_to_copy, &buffer1, &length1, &buffer2, &length2) < 0)
-	{
-		buffer_underflows++;
-		return;
-	}
+	// copy the second chunk from the start of the buffer
+	if (bytes_to_copy > cur_bytes)
+		att_memcpy(stream_buffer, (const INT16 *)((const UINT8 *)data + cur_bytes), bytes_to_copy - cur_bytes);
 
 	// adjust the input pointer
 	stream_buffer_in += bytes_to_copy;
 	if (stream_buffer_in >= stream_buffer_size)
-	{
 		stream_buffer_in -= stream_buffer_size;
-		stream_loop = 1;
-
-		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 1 (stream_buffer_in looped)\n");
-	}
 
-	// copy the first chunk
-	cur_bytes = (bytes_to_copy > length1) ? length1 : bytes_to_copy;
-	att_memcpy(buffer1, data, cur_bytes);
-
-	// adjust for the number of bytes
-	bytes_to_copy -= cur_bytes;
-	data = (INT16 *)((UINT8 *)data + cur_bytes);
-
-	// copy the second chunk
-	if (bytes_to_copy != 0)
-	{
-		cur_bytes = (bytes_to_copy > length2) ? length2 : bytes_to_copy;
-		att_memcpy(buffer2, data, cur_bytes);
-	}
-
-	// unlock
-	unlock_buffer();
+	// publish the data to the callback only once it has been written
+	atomic_add32(&stream_fill, bytes_to_copy);
 }
 
 
@@ -252,24 +161,18 @@ void sound_sdl::update_audio_stream(bool is_throttled, const INT16 *buffer, int
 	if (sample_rate() != 0 && stream_buffer)
 	{
 		int bytes_this_frame = samples_this_frame * sizeof(INT16) * 2;
-		int play_position, write_position, stream_in;
-		int orig_write; // used in LOG
-
-		play_position = stream_playpos;
-
-		write_position = stream_playpos + ((sample_rate() / 50) * sizeof(INT16) * 2);
-		orig_write = write_position;
 
 		if (!stream_in_initialized)
 		{
-			stream_in = stream_buffer_in = (write_position + stream_buffer_size) / 2;
+			// prime the buffer with silence up to the target latency; the
+			// callback isn't running yet, so the ring can be set directly
+			stream_buffer_in = stream_target_fill;
+			stream_playpos = 0;
+			stream_fill = stream_target_fill;
 
 			if (LOG_SOUND)
-			{
-				fprintf(sound_log, "stream_in = %d\n", (int)stream_in);
-				fprintf(sound_log, "stream_playpos = %d\n", (int)stream_playpos);
-				fprintf(sound_log, "write_position = %d\n", (int)write_position);
-			}
+				fprintf(sound_log, "stream_in = %d\n", (int)stream_buffer_in);
+
 			// start playing
 			SDL_PauseAudio(0);
 
@@ -277,48 +180,40 @@ void sound_sdl::update_audio_stream(bool is_throttled, const INT16 *buffer, int
 		}
 		else
 		{
-			// normalize the stream in position
-			stream_in = stream_buffer_in;
-			if (stream_in < write_position && stream_loop == 1)
-				stream_in += stream_buffer_size;
+			// read the fill with a barrier so we don't overwrite bytes the
+			// callback hasn't finished copying out
+			INT32 fill = atomic_add32(&stream_fill, 0);
 
-			// now we should have, in order:
-			//    <------pp---wp---si--------------->
-
-			// if we're between play and write positions, then bump forward, but only in full chunks
-			while (stream_in < write_position)
+			// if the callback has drained us, pad with silence back up to the
+			// target latency rather than letting every frame underflow
+			if (fill < (INT32)(sdl_xfer_samples * sizeof(INT16) * 2))
 			{
 				if (LOG_SOUND)
-					fprintf(sound_log, "Underflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
+					fprintf(sound_log, "Underflow: fill=%d  BTF=%d\n", (int)fill, (int)bytes_this_frame);
 
 				buffer_underflows++;
-				stream_in += bytes_this_frame;
+				UINT32 pad = ((INT32)stream_target_fill > fill) ? (stream_target_fill - fill) & ~3 : 0;
+				UINT32 first = MIN(pad, stream_buffer_size - stream_buffer_in);
+				memset(stream_buffer + stream_buffer_in, 0, first);
+				memset(stream_buffer, 0, pad - first);
+				stream_buffer_in = (stream_buffer_in + pad) % stream_buffer_size;
+				atomic_add32(&stream_fill, pad);
+				fill += pad;
 			}
 
-			// if we're going to overlap the play position, just skip this chunk
-			if (stream_in + bytes_this_frame > play_position + stream_buffer_size)
+			// if there's no room for this frame, just skip it
+			if (fill + bytes_this_frame > (INT32)stream_buffer_size)
 			{
 				if (LOG_SOUND)
-					fprintf(sound_log, "Overflow: PP=%d  WP=%d(%d)  SI=%d(%d)  BTF=%d\n", (int)play_position, (int)write_position, (int)orig_write, (int)stream_in, (int)stream_buffer_in, (int)bytes_this_frame);
+					fprintf(sound_log, "Overflow: fill=%d  BTF=%d\n", (int)fill, (int)bytes_this_frame);
 
 				buffer_overflows++;
 				return;
 			}
 		}
 
-		if (stream_in >= stream_buffer_size)
-		{
-			stream_in -= stream_buffer_size;
-			stream_loop = 1;
-
-			if (LOG_SOUND)
-				fprintf(sound_log, "stream_loop set to 1 (stream_in looped)\n");
-
-		}
-
 		// now we know where to copy; let's do it
-		stream_buffer_in = stream_in;
-		copy_sample_data(is_throttled, buffer, bytes_this_frame);
+		copy_sample_data(buffer, bytes_this_frame);
 	}
 }
 
@@ -348,17 +243,22 @@ void sound_sdl::set_mastervolume(int _attenuation)
 static void sdl_callback(void *userdata, Uint8 *stream, int len)
 {
 	sound_sdl *thiz = (sound_sdl *) userdata;
-	int len1, len2, sb_in;
+	int len1, len2;
 
-	sb_in = thiz->stream_buffer_in;
-	if (thiz->stream_loop)
-		sb_in += thiz->stream_buffer_size;
+	// read the fill with a barrier, so the buffer contents we copy below are
+	// at least as new as the count; then track the lowest fill level we've
+	// seen, for latency tuning
+	INT32 fill = atomic_add32(&thiz->stream_fill, 0);
+	if (fill < thiz->lowest_fill)
+		thiz->lowest_fill = fill;
 
-	if (sb_in < (thiz->stream_playpos+len))
+	if (fill < len)
 	{
 		if (LOG_SOUND)
-			fprintf(sound_log, "Underflow at sdl_callback: SPP=%d SBI=%d(%d) Len=%d\n", (int)thiz->stream_playpos, (int)sb_in, (int)thiz->stream_buffer_in, (int)len);
+			fprintf(sound_log, "Underflow at sdl_callback: SPP=%d fill=%d Len=%d\n", (int)thiz->stream_playpos, (int)fill, (int)len);
 
+		thiz->callback_underflows++;
+		memset(stream, 0, len);
 		return;
 	}
 	else if ((thiz->stream_playpos+len) > thiz->stream_buffer_size)
@@ -373,24 +273,16 @@ static void sdl_callback(void *userdata, Uint8 *stream, int len)
 	}
 
 	memcpy(stream, thiz->stream_buffer + thiz->stream_playpos, len1);
-	memset(thiz->stream_buffer + thiz->stream_playpos, 0, len1); // no longer needed
 	if (len2)
-	{
 		memcpy(stream+len1, thiz->stream_buffer, len2);
-		memset(thiz->stream_buffer, 0, len2); // no longer needed
-	}
-
 
 	// move the play cursor
 	thiz->stream_playpos += len1 + len2;
 	if (thiz->stream_playpos >= thiz->stream_buffer_size)
-	{
 		thiz->stream_playpos -= thiz->stream_buffer_size;
-		thiz->stream_loop = 0;
 
-		if (LOG_SOUND)
-			fprintf(sound_log, "stream_loop set to 0 (stream_playpos looped)\n");
-	}
+	// hand the space back to the producer
+	atomic_add32(&thiz->stream_fill, -len);
 
 	if (LOG_SOUND)
 		fprintf(sound_log, "callback: xfer len1 %d len2 %d, playpos %d\n",
@@ -430,7 +322,6 @@ int sound_sdl::init(const osd_options &options)
 
 		sdl_xfer_samples = SDL_XFER_SAMPLES;
 		stream_in_initialized = 0;
-		stream_loop = 0;
 
 		// set up the audio specs
 		aspec.freq = sample_rate();
@@ -457,6 +348,12 @@ int sound_sdl::init(const osd_options &options)
 		if (stream_buffer_size < 1024)
 			stream_buffer_size = 1024;
 
+		// aim to keep the buffer this full: the requested latency in
+		// frames, but always at least two SDL transfers
+		stream_target_fill = (sample_rate() * 2 * sizeof(INT16) * audio_latency) / 60;
+		stream_target_fill = MAX(stream_target_fill, 2 * sdl_xfer_samples * sizeof(INT16) * 2);
+		stream_target_fill = MIN(stream_target_fill, stream_buffer_size / 2) & ~3;
+
 		// create the buffers
 		if (sdl_create_buffers())
 			goto cant_create_buffers;
@@ -498,12 +395,13 @@ void sound_sdl::exit()
 	sdl_destroy_buffers();
 
 	// print out over/underflow stats
-	if (buffer_overflows || buffer_underflows)
-		osd_printf_verbose("Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+	if (buffer_overflows || buffer_underflows || callback_underflows)
+		osd_printf_verbose("Sound buffer: overflows=%d underflows=%d callback underflows=%d\n", buffer_overflows, buffer_underflows, (int)callback_underflows);
+	osd_printf_verbose("Sound buffer: target fill %u bytes, lowest fill %d bytes\n", stream_target_fill, (int)lowest_fill);
 
 	if (LOG_SOUND)
 	{
-		fprintf(sound_log, "Sound buffer: overflows=%d underflows=%d\n", buffer_overflows, buffer_underflows);
+		fprintf(sound_log, "Sound buffer: overflows=%d underflows=%d callback underflows=%d lowest fill=%d\n", buffer_overflows, buffer_underflows, (int)callback_underflows, (int)lowest_fill);
 		fclose(sound_log);
 	}
 }
@@ -519,8 +417,13 @@ int sound_sdl::sdl_create_buffers(void)
 	osd_printf_verbose("sdl_create_buffers: creating stream buffer of %u bytes\n", stream_buffer_size);
 
 	stream_buffer = global_alloc_array_clear(INT8, stream_buffer_size);
+	stream_buffer_in = 0;
 	stream_playpos = 0;
-	buf_locked = 0;
+	stream_fill = 0;
+	buffer_underflows = 0;
+	buffer_overflows = 0;
+	callback_underflows = 0;
+	lowest_fill = stream_buffer_size;
 	return 0;
 }
 
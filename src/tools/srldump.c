@@ -0,0 +1,460 @@
+// license:BSD-3-Clause
+// copyright-holders:MAMEdev Team
+/***************************************************************************
+
+    srldump.c
+
+    Sound chip register write log (.srl) dumper, analyzer and player.
+
+    Logs are produced by running with -soundlog; each sound device that
+    supports it writes <snapdir>/<system>/<tag>.srl.
+
+    Logs from an OKIM6295 can be replayed into a copy of its voice logic
+    (using the same ADPCM decoder as the emulator) to produce a WAV file
+    and a timing figure without running the machine. Other cores need a
+    running device for timers and save states, so can only be dumped.
+
+****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "osdcore.h"
+#include "coretmpl.h"
+#include "srlfile.h"
+#include "sound/okiadpcm.h"
+#include "sound/wavwrite.h"
+
+
+
+/***************************************************************************
+    CONSTANTS
+***************************************************************************/
+
+#define OKIM6295_VOICES         4
+#define OKIM6295_REGLOG_BANK    (SRL_PSEUDO_OFFSET + 0)     // must match okim6295.c
+#define OKIM6295_REGLOG_PIN7    (SRL_PSEUDO_OFFSET + 1)     // must match okim6295.c
+
+// volume table, must match okim6295_device::s_volume_table
+static const UINT8 okim6295_volume_table[16] =
+{
+	0x20, 0x16, 0x10, 0x0b, 0x08, 0x06, 0x04, 0x03,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+
+
+/***************************************************************************
+    TYPE DEFINITIONS
+***************************************************************************/
+
+struct srl_header
+{
+	UINT32      version;            /* file format version */
+	UINT32      sample_rate;        /* sample rate of the logged stream */
+	UINT32      clock;              /* clock of the logged device */
+};
+
+
+struct srl_record
+{
+	UINT64      sample;             /* stream sample number at the time of the write */
+	UINT32      offset;             /* register offset written */
+	UINT32      data;               /* data written */
+};
+
+
+/* replay state for one OKIM6295, mirroring okim6295_device */
+struct okim6295_replay
+{
+	struct voice
+	{
+		bool            playing;
+		UINT32          base_offset;    /* start of the sample in the address space */
+		UINT32          sample;         /* current nibble */
+		UINT32          count;          /* total nibbles to play */
+		INT8            volume;
+		oki_adpcm_state adpcm;
+	};
+
+	const dynamic_buffer *rom;          /* sample ROM */
+	UINT32      bank;                   /* current bank base */
+	INT32       command;                /* pending command, or -1 */
+	voice       voices[OKIM6295_VOICES];
+};
+
+
+
+/***************************************************************************
+    CORE IMPLEMENTATION
+***************************************************************************/
+
+/*-------------------------------------------------
+    get_le - fetch a little-endian value
+-------------------------------------------------*/
+
+static UINT64 get_le(const UINT8 *data, int bytes)
+{
+	UINT64 result = 0;
+	while (bytes-- > 0)
+		result = (result << 8) | data[bytes];
+	return result;
+}
+
+
+/*-------------------------------------------------
+    read_header - read and validate the header
+-------------------------------------------------*/
+
+static int read_header(FILE *file, srl_header &header)
+{
+	UINT8 buffer[SRL_HEADER_SIZE];
+
+	if (fread(buffer, 1, sizeof(buffer), file) != sizeof(buffer) || memcmp(buffer, "SRL", 4) != 0)
+	{
+		fprintf(stderr, "Error: not a sound register log\n");
+		return 1;
+	}
+
+	header.version = get_le(&buffer[4], 4);
+	header.sample_rate = get_le(&buffer[8], 4);
+	header.clock = get_le(&buffer[12], 4);
+	if (header.version != SRL_VERSION)
+	{
+		fprintf(stderr, "Error: unsupported log version %d\n", header.version);
+		return 1;
+	}
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    read_record - read the next record; returns
+    false at end of file
+-------------------------------------------------*/
+
+static bool read_record(FILE *file, srl_record &record)
+{
+	UINT8 buffer[SRL_RECORD_SIZE];
+
+	if (fread(buffer, 1, sizeof(buffer), file) != sizeof(buffer))
+		return false;
+
+	record.sample = get_le(&buffer[0], 8);
+	record.offset = get_le(&buffer[8], 4);
+	record.data = get_le(&buffer[12], 4);
+	return true;
+}
+
+
+/*-------------------------------------------------
+    dump_log - print every write in the log
+-------------------------------------------------*/
+
+static int dump_log(FILE *file, const srl_header &header)
+{
+	srl_record record;
+
+	printf("; clock %d Hz, stream %d Hz\n", header.clock, header.sample_rate);
+	while (read_record(file, record))
+		printf("%12" I64FMT "u  %08X  %08X\n", record.sample, record.offset, record.data);
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    summarize_log - print statistics about the
+    log
+-------------------------------------------------*/
+
+static int summarize_log(FILE *file, const srl_header &header)
+{
+	static UINT32 offset_count[256];
+	UINT32 pseudo_count = 0;
+	UINT32 total = 0, samples_with_writes = 0, max_per_sample = 0, current_run = 0;
+	UINT64 first = 0, last = 0;
+	srl_record record;
+
+	while (read_record(file, record))
+	{
+		if (total == 0)
+			first = record.sample;
+
+		// track how many writes land on the same sample
+		if (total == 0 || record.sample != last)
+		{
+			samples_with_writes++;
+			current_run = 0;
+		}
+		current_run++;
+		if (current_run > max_per_sample)
+			max_per_sample = current_run;
+
+		// device state changes are counted separately from bus writes
+		if (record.offset >= SRL_PSEUDO_OFFSET)
+			pseudo_count++;
+		else
+			offset_count[record.offset & 0xff]++;
+		last = record.sample;
+		total++;
+	}
+
+	printf("Clock:                 %d Hz\n", header.clock);
+	printf("Stream rate:           %d Hz\n", header.sample_rate);
+	printf("Writes:                %d\n", total);
+	if (total == 0)
+		return 0;
+
+	printf("Samples covered:       %" I64FMT "u (%" I64FMT "u to %" I64FMT "u)\n", last - first + 1, first, last);
+	if (header.sample_rate != 0)
+	{
+		double seconds = (double)(last - first + 1) / (double)header.sample_rate;
+		printf("Duration:              %.3f seconds\n", seconds);
+		printf("Writes per second:     %.1f\n", (double)total / seconds);
+	}
+	printf("Samples with writes:   %d\n", samples_with_writes);
+	printf("Max writes per sample: %d\n", max_per_sample);
+	printf("State changes:         %d\n", pseudo_count);
+
+	printf("\nWrites by offset (low 8 bits):\n");
+	for (int offset = 0; offset < 256; offset++)
+		if (offset_count[offset] != 0)
+			printf("  %02X: %d\n", offset, offset_count[offset]);
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    oki_read_byte - read from the OKIM6295's
+    address space through the current bank
+-------------------------------------------------*/
+
+static UINT8 oki_read_byte(const okim6295_replay &chip, UINT32 address)
+{
+	UINT32 offset = chip.bank + (address & 0x3ffff);
+	return (offset < chip.rom->size()) ? (*chip.rom)[offset] : 0;
+}
+
+
+/*-------------------------------------------------
+    oki_write_command - apply a command byte, as
+    okim6295_device::write_command does
+-------------------------------------------------*/
+
+static void oki_write_command(okim6295_replay &chip, UINT8 command)
+{
+	// second half of a play command: start the selected voices
+	if (chip.command != -1)
+	{
+		int voicemask = command >> 4;
+		for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++, voicemask >>= 1)
+			if ((voicemask & 1) && !chip.voices[voicenum].playing)
+			{
+				okim6295_replay::voice &voice = chip.voices[voicenum];
+				UINT32 base = chip.command * 8;
+				UINT32 start = ((oki_read_byte(chip, base + 0) << 16) | (oki_read_byte(chip, base + 1) << 8) | oki_read_byte(chip, base + 2)) & 0x3ffff;
+				UINT32 stop = ((oki_read_byte(chip, base + 3) << 16) | (oki_read_byte(chip, base + 4) << 8) | oki_read_byte(chip, base + 5)) & 0x3ffff;
+				if (start < stop)
+				{
+					voice.playing = true;
+					voice.base_offset = start;
+					voice.sample = 0;
+					voice.count = 2 * (stop - start + 1);
+					voice.adpcm.reset();
+					voice.volume = okim6295_volume_table[command & 0x0f];
+				}
+			}
+		chip.command = -1;
+	}
+
+	// first half of a play command: remember the sample number
+	else if (command & 0x80)
+		chip.command = command & 0x7f;
+
+	// otherwise, silence the selected voices
+	else
+	{
+		int voicemask = command >> 3;
+		for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++, voicemask >>= 1)
+			if (voicemask & 1)
+				chip.voices[voicenum].playing = false;
+	}
+}
+
+
+/*-------------------------------------------------
+    oki_generate - generate one sample, as
+    okim_voice::generate_adpcm does
+-------------------------------------------------*/
+
+static INT32 oki_generate(okim6295_replay &chip)
+{
+	INT32 result = 0;
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+	{
+		okim6295_replay::voice &voice = chip.voices[voicenum];
+		if (!voice.playing)
+			continue;
+
+		int nibble = oki_read_byte(chip, voice.base_offset + voice.sample / 2) >> (((voice.sample & 1) << 2) ^ 4);
+		result += voice.adpcm.clock(nibble) * voice.volume / 2;
+		if (++voice.sample >= voice.count)
+			voice.playing = false;
+	}
+	return result;
+}
+
+
+/*-------------------------------------------------
+    replay_okim6295 - replay an OKIM6295 log into
+    a WAV file, timing the generation
+-------------------------------------------------*/
+
+static int replay_okim6295(FILE *file, const srl_header &header, const char *romname, const char *wavname)
+{
+	if (header.sample_rate == 0)
+	{
+		fprintf(stderr, "Error: log has no sample rate\n");
+		return 1;
+	}
+
+	// load the sample ROM
+	dynamic_buffer rom;
+	FILE *romfile = fopen(romname, "rb");
+	if (romfile == NULL)
+	{
+		fprintf(stderr, "Error: unable to open ROM '%s'\n", romname);
+		return 1;
+	}
+	fseek(romfile, 0, SEEK_END);
+	rom.resize(ftell(romfile));
+	fseek(romfile, 0, SEEK_SET);
+	if (rom.size() == 0 || fread(&rom[0], 1, rom.size(), romfile) != rom.size())
+	{
+		fprintf(stderr, "Error: unable to read ROM '%s'\n", romname);
+		fclose(romfile);
+		return 1;
+	}
+	fclose(romfile);
+
+	wav_file *wav = wav_open(wavname, header.sample_rate, 1);
+	if (wav == NULL)
+	{
+		fprintf(stderr, "Error: unable to create '%s'\n", wavname);
+		return 1;
+	}
+
+	okim6295_replay chip;
+	chip.rom = &rom;
+	chip.bank = 0;
+	chip.command = -1;
+	for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+		chip.voices[voicenum].playing = false;
+
+	// the log counts samples at the header rate; if the chip's rate changes,
+	// step it by the ratio of the two so output stays at the header rate
+	UINT32 chip_rate = header.sample_rate;
+	UINT32 phase = 0;
+	INT32 current = 0;
+	bool started = false;
+	UINT64 position = 0, generated = 0;
+	std::vector<INT16> buffer;
+	osd_ticks_t ticks = 0;
+
+	srl_record record;
+	bool more = read_record(file, record);
+	UINT64 tail = UINT64(header.sample_rate) * 10;
+	while (more || tail-- != 0)
+	{
+		// stop the tail early once everything has finished playing
+		if (!more)
+		{
+			bool playing = false;
+			for (int voicenum = 0; voicenum < OKIM6295_VOICES; voicenum++)
+				playing |= chip.voices[voicenum].playing;
+			if (!playing)
+				break;
+		}
+
+		// generate up to the next record (or one sample of the tail)
+		UINT64 target = more ? record.sample : position + 1;
+		if (!started)
+			position = target;
+		buffer.clear();
+		osd_ticks_t start = osd_ticks();
+		for ( ; position < target; position++)
+		{
+			for (phase += chip_rate; phase >= header.sample_rate; phase -= header.sample_rate)
+				current = oki_generate(chip);
+			buffer.push_back((current < -32768) ? -32768 : (current > 32767) ? 32767 : current);
+		}
+		ticks += osd_ticks() - start;
+		if (!buffer.empty())
+			wav_add_data_16(wav, &buffer[0], buffer.size());
+		generated += buffer.size();
+
+		if (!more)
+			continue;
+
+		// apply the record
+		started = true;
+		if (record.offset == SRL_RATE_CHANGE)
+			chip_rate = record.data;
+		else if (record.offset == OKIM6295_REGLOG_BANK)
+			chip.bank = record.data;
+		else if (record.offset < SRL_PSEUDO_OFFSET)
+			oki_write_command(chip, record.data);
+		more = read_record(file, record);
+	}
+	wav_close(wav);
+
+	double audio = (double)generated / (double)header.sample_rate;
+	double elapsed = (double)ticks / (double)osd_ticks_per_second();
+	printf("Generated:             %" I64FMT "u samples (%.3f seconds)\n", generated, audio);
+	printf("Generation time:       %.3f ms\n", elapsed * 1000.0);
+	if (elapsed > 0)
+		printf("Speed:                 %.1fx real time\n", audio / elapsed);
+	return 0;
+}
+
+
+/*-------------------------------------------------
+    main - main entry point
+-------------------------------------------------*/
+
+int main(int argc, char *argv[])
+{
+	srl_header header;
+	FILE *file;
+	int result;
+
+	// validate arguments
+	bool replay = (argc == 5 && strcmp(argv[1], "-replay6295") == 0);
+	if (!replay && (argc != 3 || (strcmp(argv[1], "-dump") != 0 && strcmp(argv[1], "-info") != 0)))
+	{
+		fprintf(stderr, "Usage:\n"
+				"%s -info <file.srl>  -- summarize a sound register log\n"
+				"%s -dump <file.srl>  -- print every write in a sound register log\n"
+				"%s -replay6295 <file.srl> <rom> <out.wav>  -- replay an OKIM6295 log into a WAV file\n",
+				argv[0], argv[0], argv[0]);
+		return 1;
+	}
+
+	// open the file
+	file = fopen(argv[2], "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "Error: unable to open '%s'\n", argv[2]);
+		return 1;
+	}
+
+	// process it
+	result = read_header(file, header);
+	if (result == 0 && replay)
+		result = replay_okim6295(file, header, argv[3], argv[4]);
+	else if (result == 0)
+		result = (strcmp(argv[1], "-dump") == 0) ? dump_log(file, header) : summarize_log(file, header);
+
+	fclose(file);
+	return result;
+}